@@ -50,6 +50,7 @@
 #include <board/SketchFilter.h>
 #include <board/Style.h>
 #include <board/Text.h>
+#include <board/Tools.h>
 
 namespace LibBoard
 {
@@ -393,6 +394,29 @@ public:
    */
   void fillRectangle(const Rect & rect);
 
+  /**
+   * Draws a batch of rectangles, all with the current style. The shape
+   * vector is grown once, and the style is read once for the whole batch.
+   *
+   * @param rects Positions and sizes of the rectangles.
+   */
+  void drawRectangles(const std::vector<Rect> & rects);
+
+  /**
+   * Draws a batch of circles of a common radius, all with the current style.
+   *
+   * @param centers Centers of the circles.
+   * @param radius Radius of the circles.
+   */
+  void drawCircles(const std::vector<Point> & centers, double radius);
+
+  /**
+   * Draws a batch of independent line segments, all with the current style.
+   *
+   * @param points Segment endpoints: one segment joins points 0 and 1, the next one points 2 and 3, etc.
+   */
+  void drawLines(const std::vector<Point> & points);
+
   /**
    * Draws a circle.
    *
@@ -924,7 +948,7 @@ public:
   static Rect pageRect(PageSize size, Unit unit);
 
 protected:
-  static double toMillimeter(double x, Unit unit);
+  static inline double toMillimeter(double x, Unit unit);
 
   /**
    * Current graphical state for drawings made by the drawSomething() methods.
@@ -1058,6 +1082,23 @@ Polyline bezierControls(const Bezier & bezier, const Style & style = Style::defa
 
 // Inline methods and functions
 
+inline double Board::toMillimeter(double x, Unit unit)
+{
+  // enum class Unit { Point, Inch, Centimeter, Millimeter };
+  switch (unit) {
+  case Unit::Point:
+    return x * 25.4 / 72.0;
+  case Unit::Inch:
+    return x * 25.4;
+  case Unit::Centimeter:
+    return x * 10.0;
+  case Unit::Millimeter:
+    return x;
+  }
+  Tools::error << "toMillimeter(): bad unit (" << int(unit) << ")\n";
+  return 0;
+}
+
 inline void Board::clear(unsigned char red, unsigned char green, unsigned char blue)
 {
   clear(Color(red, green, blue));
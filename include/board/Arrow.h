@@ -113,7 +113,7 @@ struct Arrow : public Line {
    *
    * @return
    */
-  const std::string & name() const override;
+  const std::string & name() const final;
 
   /**
    * Returns a copy of the arrow, rotated around a given rotation center.
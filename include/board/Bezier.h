@@ -83,7 +83,7 @@ struct Bezier : public ShapeWithStyle {
    * @param cap
    * @param join
    */
-  Bezier(Point p0, Point control0, Point p1, Point control1,                                                  //
+  Bezier(const Point & p0, const Point & control0, const Point & p1, const Point & control1,                                                  //
          Color penColor = Style::defaultPenColor(), Color fillColor = Style::defaultFillColor(),              //
          double lineWidth = Style::defaultLineWidth(), const LineStyle lineStyle = Style::defaultLineStyle(), //
          const LineCap cap = Style::defaultLineCap(), const LineJoin join = Style::defaultLineJoin());
@@ -97,7 +97,7 @@ struct Bezier : public ShapeWithStyle {
    * @param control1 End control point
    * @param style Shape style.
    */
-  Bezier(Point p0, Point control0, Point p1, Point control1, //
+  Bezier(const Point & p0, const Point & control0, const Point & p1, const Point & control1, //
          const Style & style);
 
   /**
@@ -144,7 +144,7 @@ struct Bezier : public ShapeWithStyle {
    *
    * @return The generic name of the shape
    */
-  const std::string & name() const override;
+  const std::string & name() const final;
 
   /**
    * @brief Rotate the Bezier curve.
@@ -395,12 +395,23 @@ private:
   static const std::string _name; /**< The generic name of the shape. */
 
 protected:
+  inline void invalidateExtremums();
+
   Path _path;
   Path _controls;
+  mutable std::vector<Point> _extremums;      /**< Cached result of pathThroughLocalExtremums(). */
+  mutable bool _extremumsValid = false;       /**< Is the cached extremum path up to date? */
 };
 
 // Inline methods
 
+void Bezier::invalidateExtremums()
+{
+  _extremumsValid = false;
+}
+
+// Inline methods
+
 const Path & Bezier::path() const
 {
   return _path;
@@ -50,7 +50,7 @@ struct Dot : public ShapeWithStyle {
    *
    * @return
    */
-  const std::string & name() const override;
+  const std::string & name() const final;
 
   Point center(LineWidthFlag flage = IgnoreLineWidth) const override;
 
@@ -60,7 +60,7 @@ struct Ellipse : public ShapeWithStyle {
    *
    * @return
    */
-  const std::string & name() const override;
+  const std::string & name() const final;
 
   Point center(LineWidthFlag lineWidthFlag = IgnoreLineWidth) const override;
 
@@ -50,7 +50,7 @@ struct Group : public ShapeList {
    *
    * @return
    */
-  const std::string & name() const override;
+  const std::string & name() const final;
 
   Group & rotate(double angle, const Point & center) override;
 
@@ -70,7 +70,7 @@ struct Image : public Shape {
    *
    * @return
    */
-  const std::string & name() const override;
+  const std::string & name() const final;
 
   /**
    * Return a copy of the shape.
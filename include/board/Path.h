@@ -70,6 +70,13 @@ struct Path {
    */
   Path(std::initializer_list<Point> points);
 
+  /**
+   * @brief Construct a path from a list of points
+   * @param points A list of points
+   * @param openClosed The open/closed status of the path
+   */
+  Path(std::initializer_list<Point> points, OpenClosed openClosed) : _points(points), _openClosed(openClosed) {}
+
   /**
    * @brief Construct an open or closed empty path
    * @param openClosed The open/closed flag
@@ -81,6 +88,12 @@ struct Path {
    */
   inline void clear();
 
+  /**
+   * @brief Reserve storage for a given number of points
+   * @param n Expected number of points
+   */
+  inline void reserve(size_type n);
+
   /**
    * @brief Is the path closed?
    * @return true if the path is closed, otherwise false
@@ -147,6 +160,14 @@ struct Path {
    */
   Path & operator<<(const std::vector<Point> & v);
 
+  /**
+   * @brief Add a sequence of points at the end of the path.
+   * @param begin Iterator on the first point of the sequence.
+   * @param end Iterator past the last point of the sequence.
+   * @return The path itself.
+   */
+  inline Path & append(std::vector<Point>::const_iterator begin, std::vector<Point>::const_iterator end);
+
   /**
    * @brief Remove the last point of the path.
    * @return The path itself.
@@ -400,6 +421,17 @@ void Path::clear()
   _points.clear();
 }
 
+void Path::reserve(size_type n)
+{
+  _points.reserve(n);
+}
+
+Path & Path::append(std::vector<Point>::const_iterator begin, std::vector<Point>::const_iterator end)
+{
+  _points.insert(_points.end(), begin, end);
+  return *this;
+}
+
 Point & Path::operator[](const std::size_t n)
 {
   return _points[n];
@@ -464,14 +464,16 @@ double Point::norm() const
 
 Point Point::normalised() const
 {
-  return (*this) / norm();
+  return Point(*this).normalise();
 }
 
 Point & Point::normalise()
 {
-  double n = norm();
-  x /= n;
-  y /= n;
+  // One square root and one division; drawing coordinates are far from the
+  // overflow range that would call for hypot here.
+  const double inv = 1.0 / std::sqrt(x * x + y * y);
+  x *= inv;
+  y *= inv;
   return *this;
 }
 
@@ -43,6 +43,12 @@ struct Polyline : public ShapeWithStyle {
 
   inline Polyline(const std::vector<Point> & points, Path::OpenClosed openClosed, const Style & style);
 
+  inline Polyline(std::initializer_list<Point> points, Path::OpenClosed openClosed, Color penColor = Style::defaultPenColor(), Color fillColor = Style::defaultFillColor(),
+                  double lineWidth = Style::defaultLineWidth(), const LineStyle lineStyle = Style::defaultLineStyle(), const LineCap cap = Style::defaultLineCap(),
+                  const LineJoin join = Style::defaultLineJoin());
+
+  inline Polyline(std::initializer_list<Point> points, Path::OpenClosed openClosed, const Style & style);
+
   inline Polyline(const Path & path, Color penColor = Style::defaultPenColor(), Color fillColor = Style::defaultFillColor(), double lineWidth = Style::defaultLineWidth(),
                   const LineStyle lineStyle = Style::defaultLineStyle(), const LineCap cap = Style::defaultLineCap(), const LineJoin join = Style::defaultLineJoin());
 
@@ -302,7 +308,7 @@ struct GouraudTriangle : public Polyline {
    *
    * @return
    */
-  const std::string & name() const override;
+  const std::string & name() const final;
 
   GouraudTriangle & rotate(double angle, const Point & center) override;
 
@@ -427,6 +433,20 @@ Polyline::Polyline(const std::vector<Point> & points, Path::OpenClosed openClose
   _isCreatedRectangle = false;
 }
 
+Polyline::Polyline(std::initializer_list<Point> points, Path::OpenClosed openClosed, //
+                   Color penColor, Color fillColor, double lineWidth,                //
+                   const LineStyle lineStyle, const LineCap cap, const LineJoin join)
+    : ShapeWithStyle(penColor, fillColor, lineWidth, lineStyle, cap, join), _path(points, openClosed)
+{
+  _isCreatedRectangle = false;
+}
+
+Polyline::Polyline(std::initializer_list<Point> points, Path::OpenClosed openClosed, const Style & style) //
+    : ShapeWithStyle(style), _path(points, openClosed)
+{
+  _isCreatedRectangle = false;
+}
+
 Polyline::Polyline(const Path & path, Color penColor, Color fillColor, //
                    double lineWidth, const LineStyle lineStyle, const LineCap cap, const LineJoin join)
     : ShapeWithStyle(penColor, fillColor, lineWidth, lineStyle, cap, join), _path(path)
@@ -479,6 +479,12 @@ struct ShapeList : public Shape {
    */
   inline std::size_t size() const;
 
+  /**
+   * @brief Reserve storage for a given number of shapes (at top level).
+   * @param n Expected number of shapes.
+   */
+  inline void reserve(std::size_t n);
+
 private:
   static const std::string _name; /**< The generic name of the shape. */
 
@@ -495,11 +501,6 @@ protected:
 
 // Inline methods and functions
 
-#if defined(max)
-#undef max
-#define HAS_MSVC_MAX true
-#endif
-
 ShapeList::ShapeList() {}
 
 template <typename T> T & ShapeList::last(const std::size_t position)
@@ -671,6 +672,11 @@ std::size_t ShapeList::size() const
   return _shapes.size();
 }
 
+void ShapeList::reserve(std::size_t n)
+{
+  _shapes.reserve(n);
+}
+
 ShapeList::DepthFirstIterator::DepthFirstIterator() {}
 
 ShapeList::DepthFirstIterator::DepthFirstIterator(ShapeList * list)
@@ -783,10 +789,6 @@ ShapeList & ShapeList::operator<<(const std::vector<S> & shapes) //
   return *this;
 }
 
-#if defined(HAS_MSVC_MAX)
-#define max(A, B) ((A) > (B) ? (A) : (B))
-#endif
-
 } // namespace LibBoard
 
 #endif /* BOARD_SHAPELIST_H */
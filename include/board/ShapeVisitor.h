@@ -202,6 +202,30 @@ private:
   std::set<Color> _colors;
 };
 
+/**
+ * @brief The pen-and-fill-color extractor retrieves all pen and fill colors
+ *        in a single traversal of the shape tree.
+ */
+struct PenAndFillColorExtractor : public ConstShapeVisitor {
+  PenAndFillColorExtractor();
+  void clear();
+  void visit(const Shape &) override;
+  void visit(const Shape &) const override;
+  void visit(const Dot &) override;
+  void visit(const Line &) override;
+  void visit(const Arrow &) override;
+  void visit(const Polyline &) override;
+  void visit(const Ellipse &) override;
+  void visit(const Text &) override;
+  void visit(const Bezier &) override;
+  const std::set<Color> & penColors() const;
+  const std::set<Color> & fillColors() const;
+
+private:
+  std::set<Color> _penColors;
+  std::set<Color> _fillColors;
+};
+
 /**
  * @brief Leaf visitor may be used to apply a function on each leaf, in back-to-front order.
  */
@@ -68,7 +68,7 @@ struct ShapeWithStyle : public Shape {
   /**
    * @return "ShapeWithStyle"
    */
-  const std::string & name() const;
+  const std::string & name() const override;
 
   Shape * clone() const = 0;
 
@@ -28,6 +28,7 @@
 #include <board/Color.h>
 #include <iostream>
 #include <stack>
+#include <vector>
 
 namespace LibBoard
 {
@@ -213,7 +214,7 @@ struct Style {
 
 private:
   static Style _defaultStyle;
-  static std::stack<Style> _styleStack;
+  static std::stack<Style, std::vector<Style>> _styleStack; /**< Vector-backed to avoid std::deque chunk allocations. */
 };
 
 std::ostream & operator<<(std::ostream & out, const Style & style);
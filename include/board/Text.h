@@ -49,7 +49,7 @@ struct Text : public ShapeWithStyle {
    * @param size
    * @param color
    */
-  Text(double x, double y, const std::string & text, const Fonts::Font font, double size, Color color = Color::Black);
+  Text(double x, double y, std::string text, const Fonts::Font font, double size, Color color = Color::Black);
 
   /**
    * Create a Text sctucture.
@@ -60,7 +60,7 @@ struct Text : public ShapeWithStyle {
    * @param size
    * @param color
    */
-  Text(Point p, const std::string & text, const Fonts::Font font, double size, Color color = Color::Black);
+  Text(Point p, std::string text, const Fonts::Font font, double size, Color color = Color::Black);
 
   /**
    * Create a Text sctucture.
@@ -73,7 +73,7 @@ struct Text : public ShapeWithStyle {
    * @param size
    * @param color
    */
-  Text(double x, double y, const std::string & text, const Fonts::Font font, const std::string & svgFont, double size, Color color = Color::Black);
+  Text(double x, double y, std::string text, const Fonts::Font font, std::string svgFont, double size, Color color = Color::Black);
 
   /**
    * Create a Text sctucture.
@@ -85,14 +85,14 @@ struct Text : public ShapeWithStyle {
    * @param size
    * @param color
    */
-  Text(Point p, const std::string & text, const Fonts::Font font, const std::string & svgFont, double size, Color color = Color::Black);
+  Text(Point p, std::string text, const Fonts::Font font, std::string svgFont, double size, Color color = Color::Black);
 
   /**
    * Returns the generic name of the shape (e.g., Circle, Rectangle, etc.)
    *
    * @return
    */
-  const std::string & name() const override;
+  const std::string & name() const final;
 
   Point center(LineWidthFlag lineWidthFlag = IgnoreLineWidth) const override;
 
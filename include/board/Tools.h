@@ -26,6 +26,7 @@
 #ifndef BOARD_TOOLS_H
 #define BOARD_TOOLS_H
 
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 #include <ctime>
@@ -57,8 +58,8 @@ enum CaseSensitivity
 class MessageStream {
 public:
   inline MessageStream(std::ostream & out, const char * prefix);
-  template <typename T> inline MessageStream operator<<(const T & v);
-  inline MessageStream operator<<(std::ostream & (*fun)(std::ostream &));
+  template <typename T> inline std::ostream & operator<<(const T & v);
+  inline std::ostream & operator<<(std::ostream & (*fun)(std::ostream &));
 
 private:
   std::ostream & _out;
@@ -71,25 +72,23 @@ extern MessageStream notice;
 
 MessageStream::MessageStream(std::ostream & out, const char * prefix) : _out(out), _prefix(prefix) {}
 
+// Once the prefix has been emitted, further chained insertions go straight
+// to the underlying ostream: no per-token MessageStream temporary.
 template <typename T> //
-MessageStream MessageStream::operator<<(const T & v)
+std::ostream & MessageStream::operator<<(const T & v)
 {
   if (_prefix) {
-    _out << _prefix << v;
-  } else {
-    _out << v;
+    _out << _prefix;
   }
-  return MessageStream(_out, nullptr);
+  return _out << v;
 }
 
-MessageStream MessageStream::operator<<(std::ostream & (*fun)(std::ostream &))
+std::ostream & MessageStream::operator<<(std::ostream & (*fun)(std::ostream &))
 {
   if (_prefix) {
-    _out << _prefix << fun;
-  } else {
-    _out << fun;
+    _out << _prefix;
   }
-  return MessageStream(_out, nullptr);
+  return _out << fun;
 }
 
 inline void secured_strncpy(char * dst, const char * src, size_t count);
@@ -120,7 +119,7 @@ double boardRandDouble(double min, double max);
 
 inline bool almostEqual(const double & a, const double & b);
 
-inline double mix(const double & a, const double & b, const double & time)
+inline constexpr double mix(const double & a, const double & b, const double & time)
 {
   return a * (1 - time) + (b * time);
 }
@@ -134,7 +133,11 @@ void secured_strncpy(char * dst, const char * src, size_t count)
 #if defined(_MSC_VER)
   strncpy_s(dst, count, src, _TRUNCATE);
 #else
-  strncpy(dst, src, count - 1);
+  // Unlike strncpy, copy only the string itself: no NUL padding of the
+  // whole destination buffer, and the result is always terminated.
+  const size_t length = (std::min)(strlen(src), count - 1);
+  memcpy(dst, src, length);
+  dst[length] = '\0';
 #endif // defined( _MSC_VER )
 }
 
@@ -143,43 +146,54 @@ void secured_ctime(char * str, const time_t * t, size_t count)
 #if defined(_MSC_VER)
   ctime_s(str, count, t);
 #else
-  strncpy(str, ctime(t), count - 1);
+  secured_strncpy(str, ctime(t), count);
 #endif // defined( _MSC_VER )
 }
 
 inline bool almostEqual(const double & a, const double & b)
 {
-  const double nothing = 1e-10;
-  return a > b ? ((a - b) < nothing) : (a < b) ? ((b - a) < nothing) : true;
+  return std::fabs(a - b) < 1e-10; // Branchless: one abs and one compare.
 }
 
 template <typename T> void clamp(T & value, const T & min, const T & max)
 {
-  if (value < min) {
-    value = min;
-    return;
-  }
-  if (value > max) {
-    value = max;
-    return;
-  }
+  // min/max compile to branch-free conditional moves (minsd/maxsd for doubles).
+  value = (std::min)((std::max)(value, min), max);
 }
 
-template <typename T> inline T square(const T & t)
+template <typename T> inline constexpr T square(const T & t)
 {
   return t * t;
 }
 
+/**
+ * Compute the sine and the cosine of an angle in a single call when the
+ * compiler provides a fused builtin.
+ *
+ * @param angle An angle, in radians.
+ * @param sinAngle Sine of the angle.
+ * @param cosAngle Cosine of the angle.
+ */
+inline void sincos(double angle, double & sinAngle, double & cosAngle)
+{
+#if defined(__GNUC__)
+  __builtin_sincos(angle, &sinAngle, &cosAngle);
+#else
+  sinAngle = std::sin(angle);
+  cosAngle = std::cos(angle);
+#endif
+}
+
 bool solveQuadratic(double a, double b, double c, double & x1, double & x2);
 
-inline double rad2deg(double angle)
+inline constexpr double rad2deg(double angle)
 {
-  return (angle / M_PI) * 180;
+  return angle * (180 / M_PI); // Constant folds to a single multiplication.
 }
 
-inline double deg2rad(double angle)
+inline constexpr double deg2rad(double angle)
 {
-  return (angle / 180) * M_PI;
+  return angle * (M_PI / 180); // Constant folds to a single multiplication.
 }
 
 } // namespace Tools
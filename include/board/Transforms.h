@@ -31,7 +31,7 @@
 #include <board/TransformMatrix.h>
 #include <cmath>
 #include <limits>
-#include <map>
+#include <unordered_map>
 #include <vector>
 namespace LibBoard
 {
@@ -70,8 +70,8 @@ protected:
  */
 struct TransformEPS : public Transform {
   double mapWidth(double w) const;
-  double mapY(double y) const;
-  void setBoundingBox(const Rect & rect, const double pageWidth, const double pageHeight, const double margin);
+  double mapY(double y) const final;
+  void setBoundingBox(const Rect & rect, const double pageWidth, const double pageHeight, const double margin) final;
   double scaleBackMM(double);
   Rect pageBoundingBox() const;
 
@@ -86,19 +86,19 @@ private:
  */
 struct TransformFIG : public Transform {
   inline TransformFIG();
-  double rounded(double x) const;
-  double mapY(double y) const;
+  double rounded(double x) const final;
+  double mapY(double y) const final;
   int mapWidth(double width) const;
-  void setBoundingBox(const Rect & rect, const double pageWidth, const double pageHeight, const double margin);
+  void setBoundingBox(const Rect & rect, const double pageWidth, const double pageHeight, const double margin) final;
   unsigned int shapeDepth(const Shape *) const;
   unsigned int mapDepth(unsigned int depth) const;
-  void setDepthMap(const std::map<const Shape *, unsigned int> *, unsigned int min);
+  void setDepthMap(const std::unordered_map<const Shape *, unsigned int> *, unsigned int min);
 
 private:
   unsigned int _maxDepth;
   unsigned int _minDepth;
   double _postscriptScale;
-  const std::map<const Shape *, unsigned int> * _depthMap;
+  const std::unordered_map<const Shape *, unsigned int> * _depthMap;
 };
 
 /**
@@ -107,10 +107,10 @@ private:
  * suitable for an SVG output.
  */
 struct TransformSVG : public Transform {
-  double rounded(double x) const;
-  double mapY(double y) const;
+  double rounded(double x) const final;
+  double mapY(double y) const final;
   double mapWidth(double width) const;
-  void setBoundingBox(const Rect & rect, const double pageWidth, const double pageHeight, const double margin);
+  void setBoundingBox(const Rect & rect, const double pageWidth, const double pageHeight, const double margin) final;
   double scaleBackMM(double);
   TransformMatrix matrix() const;
   Point translation() const;
@@ -129,14 +129,9 @@ struct TransformTikZ : public TransformSVG {
 
 // Inline methods and functions
 
-#if defined(max)
-#undef max
-#define HAS_MSVC_MAX true
-#endif
-
 Transform::Transform() : _scale(1.0), _deltaX(0.0), _deltaY(0.0), _height(0.0) {}
 
-TransformFIG::TransformFIG() : _maxDepth(std::numeric_limits<int>::max()), _minDepth(0), _postscriptScale(1.0)
+TransformFIG::TransformFIG() : _maxDepth((std::numeric_limits<unsigned int>::max)()), _minDepth(0), _postscriptScale(1.0)
 {
   _depthMap = nullptr;
 }
@@ -146,10 +141,6 @@ double Transform::round(const double & x)
   return std::floor(x + 0.5);
 }
 
-#if defined(HAS_MSVC_MAX)
-#define max(A, B) ((A) > (B) ? (A) : (B))
-#endif
-
 } // namespace LibBoard
 
 #endif /* BOARD_TRANSFORMS_H */
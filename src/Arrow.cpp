@@ -43,6 +43,24 @@
 #define M_PI 3.14159265358979323846 /* pi */
 #endif
 
+namespace
+{
+// Cosine and sine of the fixed 0.3 rad arrowhead half-angle, so that
+// building an extremity does not evaluate any transcendental function.
+constexpr double kCosAngle = 0.9553364891256060;
+constexpr double kSinAngle = 0.2955202066613396;
+
+// Format the head triangle once; the fill and stroke passes reuse the string.
+std::string headPostscript(const LibBoard::Path & triangle, const std::ostream & stream, const LibBoard::TransformEPS & transform)
+{
+  std::stringstream head;
+  head.flags(stream.flags());
+  head.precision(stream.precision());
+  triangle.flushPostscript(head, transform);
+  return head.str();
+}
+} // namespace
+
 namespace LibBoard
 {
 
@@ -55,36 +73,51 @@ const std::string & Arrow::name() const
 
 Arrow Arrow::rotated(double angle, const Point & center) const
 {
-  return static_cast<Arrow &>(Arrow(*this).rotate(angle, center));
+  Arrow result(*this);
+  result.rotate(angle, center);
+  return result;
 }
 
 Arrow Arrow::rotated(double angle) const
 {
-  return static_cast<Arrow &>(Arrow(*this).rotate(angle));
+  Arrow result(*this);
+  result.rotate(angle);
+  return result;
 }
 
 Arrow Arrow::translated(double dx, double dy) const
 {
-  return static_cast<Arrow &>(Arrow(*this).translate(dx, dy));
+  Arrow result(*this);
+  result.translate(dx, dy);
+  return result;
 }
 
 Arrow Arrow::scaled(double sx, double sy) const
 {
-  return static_cast<Arrow &>(Arrow(*this).scale(sx, sy));
+  Arrow result(*this);
+  result.scale(sx, sy);
+  return result;
 }
 
 Arrow Arrow::scaled(double s) const
 {
-  return Arrow::scaled(s, s);
+  Arrow result(*this);
+  result.scale(s, s);
+  return result;
 }
 
 Arrow Arrow::resized(double w, double h, LineWidthFlag lineWidthFlag) const
 {
-  return static_cast<Arrow &>(Arrow(*this).resize(w, h, lineWidthFlag));
+  Arrow result(*this);
+  result.resize(w, h, lineWidthFlag);
+  return result;
 }
 
 Rect Arrow::boundingBox(LineWidthFlag) const
 {
+  if (_a == _b) { // A degenerate arrow has no direction to build a head from.
+    return Rect(_a.x, _a.y, 0.0, 0.0);
+  }
   const Path pArrow = extremity();
   Path pLine;
   pLine << _a << ((pArrow[0] + pArrow[2]) / 2.0);
@@ -99,46 +132,45 @@ Arrow * Arrow::clone() const
 
 Path Arrow::extremity() const
 {
-  const double angle = 0.3;
   Path result(Path::Closed);
   Point d = (_a - _b).normalised();
   d *= 10 * lineWidth();
-  const Point nd1 = d.rotated(angle);
-  const Point nd2 = d.rotated(-angle);
+  // Rotations by +/- the constant half-angle, inlined with the precomputed
+  // cosine and sine instead of going through Point::rotated.
+  const Point nd1(d.x * kCosAngle - d.y * kSinAngle, d.x * kSinAngle + d.y * kCosAngle);
+  const Point nd2(d.x * kCosAngle + d.y * kSinAngle, d.y * kCosAngle - d.x * kSinAngle);
   result << (_b + nd1) << _b << (_b + nd2);
   return result;
 }
 
 void Arrow::flushPostscript(std::ostream & stream, const TransformEPS & transform) const
 {
+  if (_a == _b) { // Normalising a null direction would spread NaNs into the output.
+    return;
+  }
   const Point ma = transform.map(_a);
   const Path triangle = extremity();
   const Point stop = (_type == ExtremityType::Stick) ? transform.map(_b) : transform.map((triangle[0] + triangle[2]) / 2.0);
+  const std::string pen = penColor().postscript(); // Formatted once, used by every pass below.
 
   stream << "\n% Arrow\n";
-  stream << penColor().postscript() << " srgb " << _style.postscriptProperties(transform) << " "
+  stream << pen << " srgb " << _style.postscriptProperties(transform) << " "
          << "n " << ma.x << " " << ma.y << " "
          << "m " << stop.x << " " << stop.y << " "
-         << "l stroke" << std::endl;
+         << "l stroke" << '\n';
 
   Style style = _style;
   style.lineStyle = SolidStyle;
   switch (_type) {
   case ExtremityType::Plain: {
-    stream << "n ";
-    triangle.flushPostscript(stream, transform);
-    stream << " " << penColor().postscript() << " srgb " << style.postscriptProperties(transform) << " fill" << std::endl;
-    stream << "n ";
-    triangle.flushPostscript(stream, transform);
-    stream << " " << penColor().postscript() << " srgb " << style.postscriptProperties(transform) << " stroke" << std::endl;
+    const std::string head = headPostscript(triangle, stream, transform);
+    stream << "n " << head << " " << pen << " srgb " << style.postscriptProperties(transform) << " fill" << '\n';
+    stream << "n " << head << " " << pen << " srgb " << style.postscriptProperties(transform) << " stroke" << '\n';
   } break;
   case ExtremityType::Closed: {
-    stream << "n ";
-    triangle.flushPostscript(stream, transform);
-    stream << " " << Color::White.postscript() << " srgb fill" << std::endl;
-    stream << "n ";
-    triangle.flushPostscript(stream, transform);
-    stream << " " << penColor().postscript() << " srgb stroke" << std::endl;
+    const std::string head = headPostscript(triangle, stream, transform);
+    stream << "n " << head << " " << Color::White.postscript() << " srgb fill" << '\n';
+    stream << "n " << head << " " << pen << " srgb stroke" << '\n';
   } break;
   case ExtremityType::Stick: {
     // FIXME : Fixe line length to the end...
@@ -146,7 +178,7 @@ void Arrow::flushPostscript(std::ostream & stream, const TransformEPS & transfor
     p.open();
     stream << "n ";
     p.flushPostscript(stream, transform);
-    stream << " " << penColor().postscript() << " srgb stroke" << std::endl;
+    stream << " " << pen << " srgb stroke" << '\n';
   } break;
   }
 }
@@ -191,14 +223,17 @@ void Arrow::flushFIG(std::ostream & stream, const TransformFIG & transform, std:
   stream << " 1.00 60.00 120.00\n";
   stream << "         ";
   stream << static_cast<int>(a.x) << " " << static_cast<int>(a.y) //
-         << " " << static_cast<int>(b.x) << " " << static_cast<int>(b.y) << std::endl;
+         << " " << static_cast<int>(b.x) << " " << static_cast<int>(b.y) << '\n';
 }
 
 void Arrow::flushSVG(std::ostream & stream, const TransformSVG & transform) const
 {
+  if (_a == _b) {
+    return;
+  }
   Path triangle = extremity();
   const Point stop = (_type == ExtremityType::Stick) ? _b : (triangle[0] + triangle[2]) / 2.0;
-  stream << "<g>" << std::endl;
+  stream << "<g>" << '\n';
   // The line
   Line(_a, stop, _style).flushSVG(stream, transform);
 
@@ -231,7 +266,7 @@ void Arrow::flushSVG(std::ostream & stream, const TransformSVG & transform) cons
   //         << " points=\"";
   //  triangle.flushSVGPoints(stream, transform);
   //  stream << " z\" />" << std::endl;
-  stream << "</g>" << std::endl;
+  stream << "</g>" << '\n';
 }
 
 void Arrow::flushTikZ(std::ostream & stream, const TransformTikZ & transform) const
@@ -239,7 +274,7 @@ void Arrow::flushTikZ(std::ostream & stream, const TransformTikZ & transform) co
   const Point a = transform.map(_a);
   const Point b = transform.map(_b);
   stream << "\\path[-latex," << _style.tikzProperties(transform) << "] (" << a.x << ',' << a.y //
-         << ") -- (" << b.x << ',' << b.y << ");" << std::endl;
+         << ") -- (" << b.x << ',' << b.y << ");" << '\n';
 }
 
 void Arrow::accept(ShapeVisitor & visitor)
@@ -37,7 +37,6 @@
 #include <cmath>
 #include <cstring>
 #include <limits>
-#include <set>
 #include <sstream>
 #include <vector>
 
@@ -49,12 +48,17 @@ namespace
 {
 inline LibBoard::Point BezierEval(const LibBoard::Point & p0, const LibBoard::Point & p1, const LibBoard::Point & p2, const LibBoard::Point & p3, double t)
 {
+  // Compute the four Bernstein weights once, then combine the coordinates
+  // with fused multiply-adds instead of a chain of Point temporaries.
   const double t2 = t * t;
-  const double t3 = t2 * t;
   const double tc = (1 - t);
   const double tc2 = tc * tc;
-  const double tc3 = tc2 * tc;
-  return tc3 * p0 + 3 * tc2 * t * p1 + 3 * tc * t2 * p2 + t3 * p3;
+  const double w0 = tc2 * tc;
+  const double w1 = 3 * tc2 * t;
+  const double w2 = 3 * tc * t2;
+  const double w3 = t2 * t;
+  return LibBoard::Point(std::fma(w0, p0.x, std::fma(w1, p1.x, std::fma(w2, p2.x, w3 * p3.x))), //
+                         std::fma(w0, p0.y, std::fma(w1, p1.y, std::fma(w2, p2.y, w3 * p3.y))));
 }
 } // namespace
 
@@ -74,7 +78,7 @@ Bezier::Bezier(const std::vector<Point> & points, const std::vector<Point> & con
 {
 }
 
-Bezier::Bezier(Point p0, Point control0, Point p1, Point control1, //
+Bezier::Bezier(const Point & p0, const Point & control0, const Point & p1, const Point & control1, //
                Color penColor, Color fillColor, double lineWidth, const LineStyle lineStyle, const LineCap cap, const LineJoin join)
     : ShapeWithStyle(penColor, fillColor, lineWidth, lineStyle, cap, join)
 {
@@ -82,7 +86,7 @@ Bezier::Bezier(Point p0, Point control0, Point p1, Point control1, //
   _controls << control0 << control1;
 }
 
-Bezier::Bezier(Point p0, Point control0, Point p1, Point control1, const Style & style) //
+Bezier::Bezier(const Point & p0, const Point & control0, const Point & p1, const Point & control1, const Style & style) //
     : ShapeWithStyle(style)
 {
   _path << p0 << p1;
@@ -111,6 +115,7 @@ const std::string & Bezier::name() const
 
 Bezier & Bezier::rotate(double angle, const Point & center)
 {
+  invalidateExtremums();
   _path.rotate(angle, center);
   _controls.rotate(angle, center);
   return *this;
@@ -118,11 +123,14 @@ Bezier & Bezier::rotate(double angle, const Point & center)
 
 Bezier Bezier::rotated(double angle, const Point & center) const
 {
-  return Bezier(*this).rotate(angle, center);
+  Bezier result(*this);
+  result.rotate(angle, center);
+  return result;
 }
 
 Bezier & Bezier::rotate(double angle)
 {
+  invalidateExtremums();
   _path.rotate(angle, center());
   _controls.rotate(angle, center());
   return *this;
@@ -130,11 +138,14 @@ Bezier & Bezier::rotate(double angle)
 
 Bezier Bezier::rotated(double angle) const
 {
-  return Bezier(*this).rotate(angle, center());
+  Bezier result(*this);
+  result.rotate(angle, center());
+  return result;
 }
 
 Bezier & Bezier::translate(double dx, double dy)
 {
+  invalidateExtremums();
   _path.translate(dx, dy);
   _controls.translate(dx, dy);
   return *this;
@@ -142,35 +153,25 @@ Bezier & Bezier::translate(double dx, double dy)
 
 Bezier Bezier::translated(double dx, double dy) const
 {
-  return Bezier(*this).translate(dx, dy);
+  Bezier result(*this);
+  result.translate(dx, dy);
+  return result;
 }
 
 Bezier & Bezier::scale(double sx, double sy)
 {
-  // Compute relative control vectors
-  const std::vector<Point> & points = _path.points();
-  std::vector<Point> controls;
-  std::vector<Point> rControls;
-  auto itC = _controls.begin();
-  for (decltype(points.size()) i = 0; i < points.size() - 1; ++i) {
-    const auto & a = points[i];
-    const auto & b = points[i + 1];
-    const auto & c0 = itC[0];
-    const auto & c1 = itC[1];
-    rControls.emplace_back((c0 - a).scaled(sx, sy));
-    rControls.emplace_back((c1 - b).scaled(sx, sy));
-    itC += 2;
-  }
+  invalidateExtremums();
+  // Path::scale maps an anchor a to c + (a - c) * s, with c the path center.
+  // A control then becomes a' + (c0 - a) * s, which by linearity is
+  // c + (c0 - c) * s: the controls scale about the same center. Apply that
+  // directly in place instead of materializing relative control vectors.
+  const Point c = _path.center();
   _path.scale(sx, sy);
-  // Compute new controls from scaled relative ones
-  controls.clear();
-  auto itRC = rControls.begin();
-  for (decltype(points.size()) i = 0; i < points.size() - 1; i += 1) {
-    controls.emplace_back(points[i] + itRC[0]);
-    controls.emplace_back(points[i + 1] + itRC[1]);
-    itRC += 2;
+  for (Path::size_type i = 0; i < _controls.size(); ++i) {
+    Point & p = _controls[i];
+    p.x = c.x + (p.x - c.x) * sx;
+    p.y = c.y + (p.y - c.y) * sy;
   }
-  _controls = Path(controls, Path::Open);
   updateLineWidth(std::max(sx, sy));
   return *this;
 }
@@ -183,23 +184,30 @@ Bezier & Bezier::scale(double s)
 
 Bezier Bezier::scaled(double sx, double sy) const
 {
-  return Bezier(*this).scale(sx, sy);
+  Bezier result(*this);
+  result.scale(sx, sy);
+  return result;
 }
 
 Bezier Bezier::scaled(double s) const
 {
-  return Bezier(*this).scale(s, s);
+  Bezier result(*this);
+  result.scale(s, s);
+  return result;
 }
 
 void Bezier::scaleAll(double s)
 {
+  invalidateExtremums();
   _path.scaleAll(s);
   _controls.scaleAll(s);
 }
 
 Bezier Bezier::resized(double w, double h, LineWidthFlag lineWidthFlag) const
 {
-  return static_cast<Bezier &>(Bezier(*this).resize(w, h, lineWidthFlag));
+  Bezier result(*this);
+  result.resize(w, h, lineWidthFlag);
+  return result;
 }
 
 Bezier * Bezier::clone() const
@@ -210,78 +218,31 @@ Bezier * Bezier::clone() const
 // TODO : test another digitization process to minimize the number of segments
 // TODO : Compute bounding box numerically according to derivative
 
-// Path Bezier::discretizedPath() const
-//{
-//  Path path;
-
-//  std::vector<Point>::const_iterator iPoint = _path.points().begin();
-//  std::vector<Point>::const_iterator endPoint = _path.points().end();
-//  std::vector<Point>::const_iterator iControl = _controls.points().begin();
-//  Point p0(iPoint->x, iPoint->y);
-//  Point p1;
-//  ++iPoint;
-//  while (iPoint != endPoint) {
-//    p1 = Point(iPoint->x, iPoint->y);
-//    Point t0 = 3 * (Point(iControl[0].x, iControl[0].y) - p0);
-//    Point t1 = 3 * (p1 - Point(iControl[1].x, iControl[1].y));
-
-//    //
-//    // Discretize a Bezier segment
-//    //
-//    const double a0 = 2 * p0.x - 2 * p1.x + t0.x + t1.x;
-//    const double b0 = -3 * p0.x + 3 * p1.x - 2 * t0.x - t1.x;
-//    const double c0 = t0.x;
-//    const double d0 = p0.x;
-//    const double a1 = 2 * p0.y - 2 * p1.y + t0.y + t1.y;
-//    const double b1 = -3 * p0.y + 3 * p1.y - 2 * t0.y - t1.y;
-//    const double c1 = t0.y;
-//    const double d1 = p0.y;
-//    // Compute optimal step
-//    double previousLength = 0.0;
-//    double length = std::numeric_limits<double>::max();
-//    double step = 1.0;
-//    while (step > 1 / 512.0 && fabs(length - previousLength) > 0.00002) {
-//      step /= 2.0;
-//      previousLength = length;
-//      // Compute length
-//      Point previous(d0, d1);
-//      length = 0.0;
-//      for (double t = step; t <= 1.0; t += step) {
-//        Point current(a0 * t * t * t + b0 * t * t + c0 * t + d0, a1 * t * t * t + b1 * t * t + c1 * t + d1);
-//        length += (current - previous).norm();
-//        previous = current;
-//      }
-//    }
-//    // Add points
-//    for (double t = 0; t <= 1.0; t += step) {
-//      //      std::cout << Point( (a0 * t * t * t + b0 * t * t + c0 * t + d0),
-//      //                     (a1 * t * t * t + b1 * t * t + c1 * t + d1) ) << std::endl;
-//      path << Point((a0 * t * t * t + b0 * t * t + c0 * t + d0), (a1 * t * t * t + b1 * t * t + c1 * t + d1));
-//    }
-
-//    ++iPoint;
-//    iControl += 2;
-//    p0 = p1;
-//  }
-//  return path;
-//}
-
 std::vector<Point> Bezier::pathThroughLocalExtremums() const
 {
-  std::set<double> tValues;
-
+  // The extremum path only depends on the geometry, so it is computed once
+  // and reused until a mutator invalidates it. boundingBox() in particular
+  // may be queried many times between two modifications of the curve.
+  if (_extremumsValid) {
+    return _extremums;
+  }
   std::vector<Point> points;
+  points.reserve(5 * _path.size());
   std::vector<Point>::const_iterator iPoint = _path.points().begin();
   std::vector<Point>::const_iterator endPoint = _path.points().end();
   std::vector<Point>::const_iterator iControl = _controls.points().begin();
-  Point p0(iPoint->x, iPoint->y);
+  Point p0 = *iPoint;
   Point p3;
   ++iPoint;
   Path::size_type interval = 0;
   while (iPoint != endPoint) {
-    tValues.clear();
-    tValues.insert(0.0); // First point
-    p3 = Point(iPoint->x, iPoint->y);
+    // At most five parameters per segment (t = 0 plus up to four extremums):
+    // a small sorted stack array does the job of a std::set without a heap
+    // allocation per inserted node.
+    double tValues[5];
+    int nbTValues = 0;
+    tValues[nbTValues++] = 0.0; // First point
+    p3 = *iPoint;
     const Point & p1 = iControl[0];
     const Point & p2 = iControl[1];
 
@@ -292,24 +253,27 @@ std::vector<Point> Bezier::pathThroughLocalExtremums() const
     double t1, t2;
     if (Tools::solveQuadratic(a.x, b.x, c.x, t1, t2)) {
       if ((0.0 < t1) && (t1 < 1.0)) {
-        tValues.insert(t1);
+        tValues[nbTValues++] = t1;
       }
       if (!Tools::almostEqual(t1, t2) && (0.0 < t2) && (t2 < 1.0)) {
-        tValues.insert(t2);
+        tValues[nbTValues++] = t2;
       }
     }
     if (Tools::solveQuadratic(a.y, b.y, c.y, t1, t2)) {
       if ((0.0 < t1) && (t1 < 1.0)) {
-        tValues.insert(t1);
+        tValues[nbTValues++] = t1;
       }
       if (!Tools::almostEqual(t1, t2) && (0.0 < t2) && (t2 < 1.0)) {
-        tValues.insert(t2);
+        tValues[nbTValues++] = t2;
       }
     }
-    for (const double & t : tValues) {
-      points.emplace_back(eval(p0, p1, p2, p3, t));
+    std::sort(tValues, tValues + nbTValues);
+    for (int i = 0; i < nbTValues; ++i) {
+      if (i && tValues[i] == tValues[i - 1]) {
+        continue; // Same duplicate policy as the former std::set.
+      }
+      points.emplace_back(eval(p0, p1, p2, p3, tValues[i]));
     }
-    tValues.clear();
     ++iPoint;
     ++interval;
     if (iPoint == endPoint) {
@@ -321,7 +285,9 @@ std::vector<Point> Bezier::pathThroughLocalExtremums() const
 
   points.emplace_back(_path.back());
 
-  return points;
+  _extremums = std::move(points);
+  _extremumsValid = true;
+  return _extremums;
 } // namespace LibBoard
 
 Path Bezier::discretizedPath() const
@@ -330,32 +296,66 @@ Path Bezier::discretizedPath() const
   std::vector<Point>::const_iterator iPoint = _path.points().begin();
   std::vector<Point>::const_iterator endPoint = _path.points().end();
   std::vector<Point>::const_iterator iControl = _controls.points().begin();
-  Point p0(iPoint->x, iPoint->y);
+  const int samplesPerSegment = 100;
+  const double h = 1.0 / samplesPerSegment;
+  const double h2 = h * h;
+  const double h3 = h2 * h;
+  Point p0 = *iPoint;
   Point p1;
   ++iPoint;
   while (iPoint != endPoint) {
-    p1 = Point(iPoint->x, iPoint->y);
+    p1 = *iPoint;
     const Point & c0 = iControl[0];
     const Point & c1 = iControl[1];
 
-    // Add points
-    for (double t = 0; t <= 1.0; t += 0.01) {
-      Point p = std::pow(1 - t, 3.0) * p0 + 3 * std::pow(1 - t, 2.0) * t * c0 + 3 * (1 - t) * std::pow(t, 2.0) * c1 + std::pow(t, 3) * p1;
-      path << p;
+    // A segment whose controls lie on the chord, between the anchors,
+    // degenerates to that chord: its two endpoints describe it exactly and
+    // the hundred samples below would all be collinear.
+    const Point seg = p1 - p0;
+    const double segLen2 = seg.x * seg.x + seg.y * seg.y;
+    const double deviation = std::fabs((c0.x - p0.x) * seg.y - (c0.y - p0.y) * seg.x) //
+                             + std::fabs((c1.x - p1.x) * seg.y - (c1.y - p1.y) * seg.x);
+    const double u0 = (c0.x - p0.x) * seg.x + (c0.y - p0.y) * seg.y;
+    const double u1 = (c1.x - p0.x) * seg.x + (c1.y - p0.y) * seg.y;
+    if (deviation <= 1e-12 * segLen2 && u0 >= 0.0 && u0 <= segLen2 && u1 >= 0.0 && u1 <= segLen2) {
+      path << p0;
+    } else {
+      // Power-basis coefficients, B(t) = a*t^3 + b*t^2 + c*t + p0, then sample
+      // by forward differencing: three additions per axis and per point instead
+      // of rebuilding the Bernstein form with std::pow at every t.
+      const Point a = (p1 - p0) + 3 * (c0 - c1);
+      const Point b = 3 * ((p0 + c1) - 2 * c0);
+      const Point c = 3 * (c0 - p0);
+      Point f = p0;
+      Point df = a * h3 + b * h2 + c * h;
+      Point d2f = 6 * (a * h3) + 2 * (b * h2);
+      const Point d3f = 6 * (a * h3);
+      for (int i = 0; i < samplesPerSegment; ++i) {
+        path << f;
+        f += df;
+        df += d2f;
+        d2f += d3f;
+      }
     }
 
     ++iPoint;
     iControl += 2;
     p0 = p1;
   }
+  if (_path.size() > 1) {
+    path << _path.back(); // The rounded t accumulation used to skip t == 1.
+  }
   return path;
 }
 
 Bezier & Bezier::operator+=(const Bezier & other)
 {
+  invalidateExtremums();
   Point end = _path.back();
   Point start = other.path().front();
   bool contiguous = (start == end);
+  _path.reserve(_path.size() + other.path().size());
+  _controls.reserve(_controls.size() + other.controls().size() + 2);
   if (!contiguous) {
     Point diff = start - end;
     const double len = diff.norm();
@@ -365,21 +365,12 @@ Bezier & Bezier::operator+=(const Bezier & other)
   }
   {
     std::vector<Point>::const_iterator it = other.path().points().begin();
-    std::vector<Point>::const_iterator limit = other.path().points().end();
     if (contiguous) {
-      ++it;
-    }
-    while (it != limit) {
-      _path.push_back(*it++);
-    }
-  }
-  {
-    std::vector<Point>::const_iterator it = other.controls().points().begin();
-    std::vector<Point>::const_iterator limit = other.controls().points().end();
-    while (it != limit) {
-      _controls.push_back(*it++);
+      ++it; // Skip the junction point, already present as our last point.
     }
+    _path.append(it, other.path().points().end());
   }
+  _controls.append(other.controls().points().begin(), other.controls().points().end());
   return *this;
 }
 
@@ -393,21 +384,29 @@ Bezier Bezier::smoothedPolyline(const std::vector<Point> & path, double roundnes
   assert(path.size() >= 2 && "Bezier::smoothedPolyline() need at least two points");
   std::vector<Point> points;
   std::vector<Point> controls;
+  points.reserve(path.size());
+  controls.reserve(2 * (path.size() - 1));
+  const double k = 0.3 * roundness;
   points.push_back(path[0]);
-  controls.push_back(mix(path[0], path[1], 0.3 * roundness));
+  controls.push_back(mix(path[0], path[1], k));
+  // The length of segment [i-1,i] is the 'next' length of the previous
+  // iteration: carry it over instead of evaluating each norm twice.
+  double previousLength = (path[1] - path[0]).norm();
   for (std::vector<Point>::size_type i = 1; i < path.size() - 1; ++i) {
-    Point previous = path[i - 1];
-    Point current = path[i];
-    Point next = path[i + 1];
-    Point orientation = (next - previous).normalised();
+    const Point & previous = path[i - 1];
+    const Point & current = path[i];
+    const Point & next = path[i + 1];
+    const double nextLength = (next - current).norm();
+    const Point orientation = (next - previous).normalised();
     points.push_back(current);
-    controls.push_back(current - ((current - previous).norm() * 0.3 * roundness) * orientation);
-    controls.push_back(current + ((next - current).norm() * 0.3 * roundness) * orientation);
+    controls.push_back(current - (previousLength * k) * orientation);
+    controls.push_back(current + (nextLength * k) * orientation);
+    previousLength = nextLength;
   }
   Point previous = path[path.size() - 2];
   Point current = path.back();
   points.push_back(current);
-  controls.push_back(mix(current, previous, 0.3 * roundness));
+  controls.push_back(mix(current, previous, k));
   return Bezier(points, controls, style);
 }
 
@@ -419,25 +418,34 @@ Bezier Bezier::smoothedPolyline(const Path & path, double roundness, const Style
     std::vector<Point> points;
     std::vector<Point> controls;
     const std::vector<Point>::size_type len = closedPath.size();
+    points.reserve(len);
+    controls.reserve(2 * (len - 1));
 
+    const double k = 0.3 * roundness;
     Point previous = closedPath[len - 2];
     Point current = closedPath[0];
     Point next = closedPath[1];
     Point orientation = (next - previous).normalised();
+    const double closingLength = (current - previous).norm();
+    double previousLength = (next - current).norm();
     points.push_back(current);
-    controls.push_back(current + ((next - current).norm() * 0.3 * roundness) * orientation);
+    controls.push_back(current + (previousLength * k) * orientation);
 
+    // As in the open overload, each segment length is computed once and
+    // carried over to the next iteration.
     for (std::vector<Point>::size_type i = 1; i < len - 1; ++i) {
-      Point previous = closedPath[i - 1];
-      Point current = closedPath[i];
-      Point next = closedPath[i + 1];
-      Point orientation = (next - previous).normalised();
+      const Point & previous = closedPath[i - 1];
+      const Point & current = closedPath[i];
+      const Point & next = closedPath[i + 1];
+      const double nextLength = (next - current).norm();
+      const Point orientation = (next - previous).normalised();
       points.push_back(current);
-      controls.push_back(current - ((current - previous).norm() * 0.3 * roundness) * orientation);
-      controls.push_back(current + ((next - current).norm() * 0.3 * roundness) * orientation);
+      controls.push_back(current - (previousLength * k) * orientation);
+      controls.push_back(current + (nextLength * k) * orientation);
+      previousLength = nextLength;
     }
     points.push_back(current);
-    controls.push_back(current - ((current - previous).norm() * 0.3 * roundness) * orientation);
+    controls.push_back(current - (closingLength * k) * orientation);
     return Bezier(points, controls, style);
   } else {
     return smoothedPolyline(path.points(), roundness, style);
@@ -472,7 +480,7 @@ Point Bezier::eval(Path::size_type interval, double t) const
 
 void Bezier::flushPostscript(std::ostream & stream, const TransformEPS & transform) const
 {
-  if (_path.empty()) {
+  if (_path.size() < 2) { // A Bezier needs at least one segment.
     return;
   }
   if (_controls.size() != 2 * (_path.size() - 1)) {
@@ -480,57 +488,51 @@ void Bezier::flushPostscript(std::ostream & stream, const TransformEPS & transfo
     return;
   }
 
+  // Map every path and control point once up front, so the fill and stroke
+  // passes below share the transformed coordinates instead of re-mapping
+  // each of them through the transform.
+  const std::vector<Point> & points = _path.points();
+  const std::vector<Point> & controls = _controls.points();
+  std::vector<Point> mappedPath;
+  mappedPath.reserve(points.size());
+  for (const Point & p : points) {
+    mappedPath.push_back(transform.map(p));
+  }
+  std::vector<Point> mappedControls;
+  mappedControls.reserve(controls.size());
+  for (const Point & p : controls) {
+    mappedControls.push_back(transform.map(p));
+  }
+
+  // The "x y m cx1 cy1 cx2 cy2 x y ct ..." sequence is the same for the fill
+  // and the stroke passes: format it once and stream the string twice.
+  std::stringstream body;
+  body.flags(stream.flags());
+  body.precision(stream.precision());
+  int count = 0;
+  body << mappedPath[0].x << " " << mappedPath[0].y << " m";
+  for (std::size_t i = 1, c = 0; i < mappedPath.size(); ++i, c += 2) {
+    body << " " << mappedControls[c].x << " " << mappedControls[c].y << " "  //
+         << mappedControls[c + 1].x << " " << mappedControls[c + 1].y << " " //
+         << mappedPath[i].x << " " << mappedPath[i].y << " ct";
+    count = (count + 1) % 6;
+    if (!count)
+      body << "\n                  ";
+  }
+  const std::string bodyString = body.str();
+
   stream << "\n% Bezier\n";
   if (filled()) {
-    stream << "n ";
-
-    // Fill
-    std::vector<Point>::const_iterator iPoint = _path.points().begin();
-    std::vector<Point>::const_iterator endPoint = _path.points().end();
-    std::vector<Point>::const_iterator iControl = _controls.points().begin();
-    int count = 0;
-    stream << transform.mapX(iPoint->x) << " " << transform.mapY(iPoint->y) << " m";
-    ++iPoint;
-    while (iPoint != endPoint) {
-      stream << " " << transform.mapX(iControl[0].x) << " " << transform.mapY(iControl[0].y) << " " << transform.mapX(iControl[1].x) << " " << transform.mapY(iControl[1].y) << " "
-             << transform.mapX(iPoint->x) << " " << transform.mapY(iPoint->y) << " ct";
-      ++iPoint;
-      iControl += 2;
-      count = (count + 1) % 6;
-      if (!count)
-        stream << "\n                  ";
-    }
-    stream << " ";
-
+    stream << "n " << bodyString << " ";
     fillColor().flushPostscript(stream);
     stream << " " << _style.postscriptProperties(transform);
-    stream << " fill" << std::endl;
+    stream << " fill" << '\n';
   }
   if (penColor() != Color::Null && lineWidth() != 0.0) {
     stream << " " << _style.postscriptProperties(transform) << "\n";
-    stream << "n ";
-
-    // Stroke
-    std::vector<Point>::const_iterator iPoint = _path.points().begin();
-    std::vector<Point>::const_iterator endPoint = _path.points().end();
-    std::vector<Point>::const_iterator iControl = _controls.points().begin();
-    int count = 0;
-    stream << transform.mapX(iPoint->x) << " " << transform.mapY(iPoint->y) << " m";
-    ++iPoint;
-    while (iPoint != endPoint) {
-      stream << " " << transform.mapX(iControl[0].x) << " " << transform.mapY(iControl[0].y) << " " //
-             << transform.mapX(iControl[1].x) << " " << transform.mapY(iControl[1].y) << " "        //
-             << transform.mapX(iPoint->x) << " " << transform.mapY(iPoint->y) << " ct";
-      ++iPoint;
-      iControl += 2;
-      count = (count + 1) % 6;
-      if (!count)
-        stream << "\n                  ";
-    }
-
-    stream << " ";
+    stream << "n " << bodyString << " ";
     penColor().flushPostscript(stream);
-    stream << " stroke" << std::endl;
+    stream << " stroke" << '\n';
   }
 }
 
@@ -545,7 +547,7 @@ void Bezier::flushFIG(std::ostream & stream, const TransformFIG & transform, std
 
 void Bezier::flushSVG(std::ostream & stream, const TransformSVG & transform) const
 {
-  if (_path.empty()) {
+  if (_path.size() < 2) { // A Bezier needs at least one segment.
     return;
   }
   if (_controls.size() != 2 * (_path.size() - 1)) {
@@ -553,7 +555,7 @@ void Bezier::flushSVG(std::ostream & stream, const TransformSVG & transform) con
     return;
   }
   stream << "<path";
-  stream << _style.svgProperties(transform) << std::endl;
+  stream << _style.svgProperties(transform) << '\n';
   stream << "          d=\"";
   std::vector<Point>::const_iterator iPoint = _path.points().begin();
   std::vector<Point>::const_iterator endPoint = _path.points().end();
@@ -573,7 +575,7 @@ void Bezier::flushSVG(std::ostream & stream, const TransformSVG & transform) con
       stream << "\n                  ";
     }
   }
-  stream << "\" />" << std::endl;
+  stream << "\" />" << '\n';
 }
 
 void Bezier::flushTikZ(std::ostream & stream, const TransformTikZ & transform) const
@@ -616,15 +618,25 @@ Shape * Bezier::accept(const CompositeShapeTransform & transform) const
 
 Rect Bezier::boundingBox(LineWidthFlag lineWidthFlag) const
 {
-  // Path path = discretizedPath(); // DONE: Make it more "analytical".
-  Path path(pathThroughLocalExtremums(), Path::Open);
+  const std::vector<Point> points = pathThroughLocalExtremums();
   Rect result;
   switch (lineWidthFlag) {
   case UseLineWidth:
-    result = Tools::pathBoundingBox(path, lineWidth(), lineCap(), RoundJoin);
+    result = Tools::pathBoundingBox(Path(points, Path::Open), lineWidth(), lineCap(), RoundJoin);
     break;
   case IgnoreLineWidth:
-    result = path.boundingBox();
+    // Running min/max over the extremum points; no Path to materialize here.
+    if (!points.empty()) {
+      double xMin = points.front().x, xMax = xMin;
+      double yMin = points.front().y, yMax = yMin;
+      for (const Point & p : points) {
+        xMin = std::min(xMin, p.x);
+        xMax = std::max(xMax, p.x);
+        yMin = std::min(yMin, p.y);
+        yMax = std::max(yMax, p.y);
+      }
+      result = Rect(xMin, yMax, xMax - xMin, yMax - yMin);
+    }
     break;
   }
   using ::operator<<;
@@ -38,13 +38,11 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <locale>
 #include <map>
+#include <unordered_map>
 #include <typeinfo>
 
-#if defined(max)
-#undef max
-#endif
-
 namespace
 {
 
@@ -68,24 +66,106 @@ const double pageSizes[][2] = {
 
 const double ppmm = 72.0 / 25.4;
 
-struct ShapeRectDepth {
-  const LibBoard::Shape * shape;
-  const LibBoard::Rect bbox;
-  const unsigned int depth;
-};
-
-unsigned int findNextDepth(const LibBoard::Rect & bbox, const std::vector<ShapeRectDepth> & depths)
+// Scale the three channels of a color by a brightness factor, saturating at
+// white. Grouping the channels in one helper lets the compiler vectorise the
+// multiply/min/convert sequence instead of interleaving nine scalar calls.
+LibBoard::Color modulatedColor(LibBoard::Color color, float brightness)
 {
-  // FIXME : Improve intersection detection
+  color.red(static_cast<unsigned char>(std::min(255.0f, color.red() * brightness)));
+  color.green(static_cast<unsigned char>(std::min(255.0f, color.green() * brightness)));
+  color.blue(static_cast<unsigned char>(std::min(255.0f, color.blue() * brightness)));
+  return color;
+}
 
-  unsigned int next = std::numeric_limits<unsigned int>::max();
-  for (const ShapeRectDepth & srd : depths) {
-    if (bbox.strictlyIntersects(srd.bbox) && srd.depth <= next) {
-      next = srd.depth - 1;
+/**
+ * A uniform grid over the drawing's bounding box used to stack FIG depths.
+ * Each cell lists the shapes whose box overlaps it, so a new shape is only
+ * tested against the shapes sharing one of its cells instead of against
+ * every shape placed before it.
+ */
+struct DepthGrid {
+  DepthGrid(const LibBoard::Rect & bounds, std::size_t expectedCount)
+  {
+    _resolution = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(expectedCount ? expectedCount : 1))));
+    if (_resolution < 1) {
+      _resolution = 1;
     }
+    if (_resolution > 64) {
+      _resolution = 64;
+    }
+    _left = bounds.left;
+    _top = bounds.top;
+    _cellWidth = (bounds.width > 0.0) ? (bounds.width / _resolution) : 1.0;
+    _cellHeight = (bounds.height > 0.0) ? (bounds.height / _resolution) : 1.0;
+    _cells.resize(static_cast<std::size_t>(_resolution) * _resolution);
+    _stamp = 0;
   }
-  return next;
-}
+
+  // Lowest depth that a shape with this box may take, i.e. one less than the
+  // smallest depth among the already-placed shapes it overlaps.
+  // The placed shapes' boxes and depths live in two parallel vectors so the
+  // scan below touches only the fields it reads.
+  unsigned int nextDepth(const LibBoard::Rect & bbox, const std::vector<LibBoard::Rect> & boxes, const std::vector<unsigned int> & depths)
+  {
+    unsigned int next = std::numeric_limits<unsigned int>::max();
+    ++_stamp; // A shape spanning several cells is tested once thanks to the stamp.
+    int i0, i1, j0, j1;
+    cellSpan(bbox, i0, i1, j0, j1);
+    for (int i = i0; i <= i1; ++i) {
+      for (int j = j0; j <= j1; ++j) {
+        for (const std::size_t index : _cells[static_cast<std::size_t>(i) * _resolution + j]) {
+          if (_visited[index] == _stamp) {
+            continue;
+          }
+          _visited[index] = _stamp;
+          if (bbox.strictlyIntersects(boxes[index]) && depths[index] <= next) {
+            next = depths[index] - 1;
+          }
+        }
+      }
+    }
+    return next;
+  }
+
+  void insert(std::size_t index, const LibBoard::Rect & bbox)
+  {
+    _visited.push_back(0);
+    int i0, i1, j0, j1;
+    cellSpan(bbox, i0, i1, j0, j1);
+    for (int i = i0; i <= i1; ++i) {
+      for (int j = j0; j <= j1; ++j) {
+        _cells[static_cast<std::size_t>(i) * _resolution + j].push_back(index);
+      }
+    }
+  }
+
+private:
+  void cellSpan(const LibBoard::Rect & bbox, int & i0, int & i1, int & j0, int & j1) const
+  {
+    j0 = clampIndex((bbox.left - _left) / _cellWidth);
+    j1 = clampIndex((bbox.right() - _left) / _cellWidth);
+    i0 = clampIndex((_top - bbox.top) / _cellHeight);
+    i1 = clampIndex((_top - bbox.bottom()) / _cellHeight);
+  }
+
+  int clampIndex(double value) const
+  {
+    if (!(value > 0.0)) {
+      return 0;
+    }
+    const int index = static_cast<int>(value);
+    return (index < _resolution) ? index : (_resolution - 1);
+  }
+
+  int _resolution;
+  double _left;
+  double _top;
+  double _cellWidth;
+  double _cellHeight;
+  std::vector<std::vector<std::size_t>> _cells;
+  std::vector<unsigned int> _visited; // Per-shape stamp of the last query that saw it.
+  unsigned int _stamp;
+};
 
 } // namespace
 
@@ -108,17 +188,10 @@ Board::Board(const Board & other) : ShapeList(other), _state(other._state), _bac
 Board & Board::operator=(const Board & other)
 {
   deleteShapes();
-  if (!other._shapes.size()) {
-    return (*this);
-  }
-  _shapes.resize(other._shapes.size(), nullptr);
-  std::vector<Shape *>::iterator t = _shapes.begin();
-  std::vector<Shape *>::const_iterator i = other._shapes.begin();
-  std::vector<Shape *>::const_iterator end = other._shapes.end();
-  while (i != end) {
-    *t = (*i)->clone();
-    ++i;
-    ++t;
+  _shapes.clear(); // Also drops the deleted pointers when other is empty.
+  _shapes.reserve(other._shapes.size());
+  for (const Shape * shape : other._shapes) {
+    _shapes.push_back(shape->clone());
   }
   return *this;
 }
@@ -176,13 +249,18 @@ Board & Board::translate(double dx, double dy)
 Board & Board::scale(double sx, double sy)
 {
   if (_clippingPath.size()) {
-    Point delta = _clippingPath.center() - center();
-    delta.x *= sx;
-    delta.y *= sy;
-    _clippingPath.scale(sx, sy);
+    // ShapeList::scale preserves the board's center, so the clipping path
+    // follows the shapes by being scaled about that same center: one pass
+    // over its points instead of a scale about its own center followed by
+    // a corrective translation.
+    const Point c = center();
     ShapeList::scale(sx, sy);
-    delta = (center() + delta) - _clippingPath.center();
-    _clippingPath.translate(delta.x, delta.y);
+    const std::size_t size = _clippingPath.size();
+    for (std::size_t i = 0; i < size; ++i) {
+      Point & p = _clippingPath[i];
+      p.x = c.x + (p.x - c.x) * sx;
+      p.y = c.y + (p.y - c.y) * sy;
+    }
   } else {
     ShapeList::scale(sx, sy);
   }
@@ -191,17 +269,7 @@ Board & Board::scale(double sx, double sy)
 
 Board & Board::scale(double s)
 {
-  if (_clippingPath.size()) {
-    Point delta = _clippingPath.center() - center();
-    delta *= s;
-    _clippingPath.scale(s);
-    ShapeList::scale(s);
-    delta = (center() + delta) - _clippingPath.center();
-    _clippingPath.translate(delta.x, delta.y);
-  } else {
-    ShapeList::scale(s);
-  }
-  return (*this);
+  return scale(s, s);
 }
 
 Board Board::rotated(double angle, const Point & center)
@@ -322,12 +390,12 @@ void Board::drawArrow(Point p, Point q, Arrow::ExtremityType type)
 
 void Board::drawRectangle(double left, double top, double width, double height)
 {
-  _shapes.push_back(LibBoard::rectangle(left, top, width, height, _state.style).clone());
+  _shapes.push_back(new Polyline(LibBoard::rectangle(left, top, width, height, _state.style)));
 }
 
 void Board::drawRectangle(const Rect & rect)
 {
-  _shapes.push_back(LibBoard::rectangle(rect.left, rect.top, rect.width, rect.height, _state.style).clone());
+  _shapes.push_back(new Polyline(LibBoard::rectangle(rect.left, rect.top, rect.width, rect.height, _state.style)));
 }
 
 void Board::fillRectangle(double left, double top, double width, double height)
@@ -336,7 +404,7 @@ void Board::fillRectangle(double left, double top, double width, double height)
   style.lineWidth = 0.0;
   style.fillColor = style.penColor;
   style.penColor = Color::Null;
-  _shapes.push_back(LibBoard::rectangle(left, top, width, height, style).clone());
+  _shapes.push_back(new Polyline(LibBoard::rectangle(left, top, width, height, style)));
 }
 
 void Board::fillRectangle(const Rect & rect)
@@ -344,14 +412,41 @@ void Board::fillRectangle(const Rect & rect)
   fillRectangle(rect.left, rect.top, rect.width, rect.height);
 }
 
+void Board::drawRectangles(const std::vector<Rect> & rects)
+{
+  _shapes.reserve(_shapes.size() + rects.size());
+  const Style & style = _state.style;
+  for (const Rect & rect : rects) {
+    _shapes.push_back(new Polyline(LibBoard::rectangle(rect.left, rect.top, rect.width, rect.height, style)));
+  }
+}
+
+void Board::drawCircles(const std::vector<Point> & centers, double radius)
+{
+  _shapes.reserve(_shapes.size() + centers.size());
+  const Style & style = _state.style;
+  for (const Point & center : centers) {
+    _shapes.push_back(new Ellipse(LibBoard::circle(center, radius, style)));
+  }
+}
+
+void Board::drawLines(const std::vector<Point> & points)
+{
+  _shapes.reserve(_shapes.size() + points.size() / 2);
+  const Style & style = _state.style;
+  for (std::vector<Point>::size_type i = 0; i + 1 < points.size(); i += 2) {
+    _shapes.push_back(new Line(points[i], points[i + 1], style));
+  }
+}
+
 void Board::drawCircle(double x, double y, double radius)
 {
-  _shapes.push_back(LibBoard::circle(x, y, radius, _state.style.penColor, _state.style.fillColor, _state.style.lineWidth, _state.style.lineStyle).clone());
+  _shapes.push_back(new Ellipse(LibBoard::circle(x, y, radius, _state.style.penColor, _state.style.fillColor, _state.style.lineWidth, _state.style.lineStyle)));
 }
 
 void Board::fillCircle(double x, double y, double radius)
 {
-  _shapes.push_back(LibBoard::circle(x, y, radius, Color::Null, _state.style.penColor, 0.0, _state.style.lineStyle).clone());
+  _shapes.push_back(new Ellipse(LibBoard::circle(x, y, radius, Color::Null, _state.style.penColor, 0.0, _state.style.lineStyle)));
 }
 
 void Board::drawEllipse(double x, double y, double xRadius, double yRadius)
@@ -381,26 +476,22 @@ void Board::fillPolyline(const std::vector<Point> & points)
 
 void Board::drawTriangle(double x1, double y1, double x2, double y2, double x3, double y3)
 {
-  std::vector<Point> points = {Point(x1, y1), Point(x2, y2), Point(x3, y3)};
-  _shapes.push_back(new Polyline(points, Path::Closed, _state.style));
+  _shapes.push_back(new Polyline({Point(x1, y1), Point(x2, y2), Point(x3, y3)}, Path::Closed, _state.style));
 }
 
 void Board::drawTriangle(const Point & p1, const Point & p2, const Point & p3)
 {
-  std::vector<Point> points = {p1, p2, p3};
-  _shapes.push_back(new Polyline(points, Path::Closed, _state.style));
+  _shapes.push_back(new Polyline({p1, p2, p3}, Path::Closed, _state.style));
 }
 
 void Board::fillTriangle(double x1, double y1, double x2, double y2, double x3, double y3)
 {
-  std::vector<Point> points = {Point(x1, y1), Point(x2, y2), Point(x3, y3)};
-  _shapes.push_back(new Polyline(points, Path::Closed, Color::Null, _state.style.penColor, 0.0, _state.style.lineStyle, _state.style.lineCap, _state.style.lineJoin));
+  _shapes.push_back(new Polyline({Point(x1, y1), Point(x2, y2), Point(x3, y3)}, Path::Closed, Color::Null, _state.style.penColor, 0.0, _state.style.lineStyle, _state.style.lineCap, _state.style.lineJoin));
 }
 
 void Board::fillTriangle(const Point & p1, const Point & p2, const Point & p3)
 {
-  std::vector<Point> points = {p1, p2, p3};
-  _shapes.push_back(new Polyline(points, Path::Closed, Color::Null, _state.style.penColor, 0.0, _state.style.lineStyle, _state.style.lineCap, _state.style.lineJoin));
+  _shapes.push_back(new Polyline({p1, p2, p3}, Path::Closed, Color::Null, _state.style.penColor, 0.0, _state.style.lineStyle, _state.style.lineCap, _state.style.lineJoin));
 }
 
 void Board::fillGouraudTriangle(const Point & p1, const Color & color1, const Point & p2, const Color & color2, const Point & p3, const Color & color3, unsigned char divisions)
@@ -410,19 +501,10 @@ void Board::fillGouraudTriangle(const Point & p1, const Color & color1, const Po
 
 void Board::fillGouraudTriangle(const Point & p1, const float brightness1, const Point & p2, const float brightness2, const Point & p3, const float brightness3, unsigned char divisions)
 {
-  Color color1(_state.style.penColor);
-  Color color2(_state.style.penColor);
-  Color color3(_state.style.penColor);
-  color1.red(static_cast<unsigned char>(std::min(255.0f, color1.red() * brightness1)));
-  color1.green(static_cast<unsigned char>(std::min(255.0f, color1.green() * brightness1)));
-  color1.blue(static_cast<unsigned char>(std::min(255.0f, color1.blue() * brightness1)));
-  color2.red(static_cast<unsigned char>(std::min(255.0f, color2.red() * brightness2)));
-  color2.green(static_cast<unsigned char>(std::min(255.0f, color2.green() * brightness2)));
-  color2.blue(static_cast<unsigned char>(std::min(255.0f, color2.blue() * brightness2)));
-  color3.red(static_cast<unsigned char>(std::min(255.0f, color3.red() * brightness3)));
-  color3.green(static_cast<unsigned char>(std::min(255.0f, color3.green() * brightness3)));
-  color3.blue(static_cast<unsigned char>(std::min(255.0f, color3.blue() * brightness3)));
-  fillGouraudTriangle(p1, color1, p2, color2, p3, color3, divisions);
+  const Color & penColor = _state.style.penColor;
+  fillGouraudTriangle(p1, modulatedColor(penColor, brightness1), //
+                      p2, modulatedColor(penColor, brightness2), //
+                      p3, modulatedColor(penColor, brightness3), divisions);
 }
 
 void Board::drawText(double x, double y, const char * text)
@@ -448,8 +530,7 @@ void Board::drawText(Point p, const std::string & str)
 void Board::drawBoundingBox(LineWidthFlag lineWidthFlag)
 {
   Rect bbox = boundingBox(lineWidthFlag);
-  Polyline rectangle = LibBoard::rectangle(bbox.left, bbox.top, bbox.width, bbox.height, _state.style);
-  _shapes.push_back(rectangle.clone());
+  _shapes.push_back(new Polyline(LibBoard::rectangle(bbox.left, bbox.top, bbox.width, bbox.height, _state.style)));
 }
 
 void Board::setClippingRectangle(double x, double y, double width, double height)
@@ -469,12 +550,7 @@ void Board::setClippingRectangle(const Rect & rect)
 void Board::setClippingPath(const std::vector<Point> & points)
 {
   _clippingPath.clear();
-  std::vector<Point>::const_iterator it = points.begin();
-  std::vector<Point>::const_iterator end = points.end();
-  while (it != end) {
-    _clippingPath << *it;
-    ++it;
-  }
+  _clippingPath << points; // Bulk append: one growth instead of one per point.
 }
 
 void Board::setClippingPath(const Path & path)
@@ -490,21 +566,37 @@ void Board::setClippingPath(const Path & path)
 
 void Board::addDuplicates(const Shape & shape, std::size_t times, double dx, double dy, double scale)
 {
+  if (!times) {
+    return;
+  }
   Shape * s = shape.clone();
-  while (times--) {
+  _shapes.reserve(_shapes.size() + times);
+  while (--times) {
     (*this) << (*s);
     if (scale != 1.0) {
       s->scale(scale);
     }
     s->translate(dx, dy);
   }
-  delete s;
+  // The template carries the last duplicate's transform already: hand it
+  // over instead of cloning it once more, unless it is a ShapeList that
+  // operator<< would flatten.
+  if (typeid(*s) == typeid(ShapeList)) {
+    (*this) << (*s);
+    delete s;
+  } else {
+    _shapes.push_back(s);
+  }
 }
 
 void Board::addDuplicates(const Shape & shape, std::size_t times, double dx, double dy, double scaleX, double scaleY, double angle)
 {
+  if (!times) {
+    return;
+  }
   Shape * s = shape.clone();
-  while (times--) {
+  _shapes.reserve(_shapes.size() + times);
+  while (--times) {
     (*this) << (*s);
     if (scaleX != 1.0 || scaleY != 1.0) {
       s->scale(scaleX, scaleY);
@@ -516,19 +608,25 @@ void Board::addDuplicates(const Shape & shape, std::size_t times, double dx, dou
       s->rotate(angle);
     }
   }
-  delete s;
+  // As above: the template becomes the last duplicate.
+  if (typeid(*s) == typeid(ShapeList)) {
+    (*this) << (*s);
+    delete s;
+  } else {
+    _shapes.push_back(s);
+  }
 }
 
 void Board::saveEPS(const char * filename, PageSize size, double margin, Unit unit, const std::string & title) const
 {
   if (size == PageSize::BoundingBox) {
-    if (title == std::string()) {
+    if (title.empty()) {
       saveEPS(filename, 0.0, 0.0, margin, unit, filename);
     } else {
       saveEPS(filename, 0.0, 0.0, margin, unit, title);
     }
   } else {
-    if (title == std::string()) {
+    if (title.empty()) {
       saveEPS(filename, pageSizes[int(size)][0], pageSizes[int(size)][1], toMillimeter(margin, unit), Unit::Millimeter, filename);
     } else {
       saveEPS(filename, pageSizes[int(size)][0], pageSizes[int(size)][1], toMillimeter(margin, unit), Unit::Millimeter, title);
@@ -547,9 +645,12 @@ void Board::saveEPS(std::ostream & out, PageSize size, double margin, Unit unit,
 
 void Board::saveEPS(std::ostream & out, double pageWidth, double pageHeight, double margin, Unit unit, const std::string & title) const
 {
-  out << "%!PS-Adobe-2.0 EPSF-2.0" << std::endl;
-  out << "%%Title: " << title << std::endl;
-  out << "%%Creator: Board library (v" << BOARD_VERSION_STRING << ") Copyleft 2007 Sebastien Fourey" << std::endl;
+  // Numbers must be written with the C locale anyway, and the classic facets
+  // skip the grouping logic a user-imbued locale may drag in.
+  const std::locale previousLocale = out.imbue(std::locale::classic());
+  out << "%!PS-Adobe-2.0 EPSF-2.0" << '\n';
+  out << "%%Title: " << title << '\n';
+  out << "%%Creator: Board library (v" << BOARD_VERSION_STRING << ") Copyleft 2007 Sebastien Fourey" << '\n';
   {
     time_t t = time(nullptr);
     char str_time[255];
@@ -559,24 +660,26 @@ void Board::saveEPS(std::ostream & out, double pageWidth, double pageHeight, dou
 
   Rect bbox = boundingBox(UseLineWidth);
   bool clipping = _clippingPath.size() > 2;
+  Rect clipBox; // The clipping path's box, computed once and reused by the cull loop below.
   if (clipping) {
-    bbox = bbox && _clippingPath.boundingBox();
+    clipBox = _clippingPath.boundingBox();
+    bbox = bbox && clipBox;
   }
   TransformEPS transform;
   if (pageWidth == 0.0 && pageHeight == 0.0) { // Fit to bounding box using given unit.
     transform.setBoundingBox(bbox, toMillimeter(bbox.width, unit), toMillimeter(bbox.height, unit), -toMillimeter(margin, unit));
 
     Rect page = transform.pageBoundingBox();
-    out << "%%BoundingBox: " << std::setprecision(8) << page.left << " " << page.bottom() << " " << page.right() << " " << page.top << std::endl;
+    out << "%%BoundingBox: " << std::setprecision(8) << page.left << " " << page.bottom() << " " << page.right() << " " << page.top << '\n';
 
   } else {
     transform.setBoundingBox(bbox, toMillimeter(pageWidth, unit), toMillimeter(pageHeight, unit), toMillimeter(margin, unit));
     Rect page = transform.pageBoundingBox();
-    out << "%%BoundingBox: " << std::setprecision(8) << page.left << " " << page.bottom() << " " << page.right() << " " << page.top << std::endl;
+    out << "%%BoundingBox: " << std::setprecision(8) << page.left << " " << page.bottom() << " " << page.right() << " " << page.top << '\n';
   }
 
-  out << "%Magnification: 1.0000" << std::endl;
-  out << "%%EndComments" << std::endl;
+  out << "%Magnification: 1.0000" << '\n';
+  out << "%%EndComments" << '\n';
 
   out << "\n"
          "/cp {closepath} bind def\n"
@@ -610,7 +713,7 @@ void Board::saveEPS(std::ostream & out, double pageWidth, double pageHeight, dou
   if (clipping) {
     out << " newpath ";
     _clippingPath.flushPostscript(out, transform);
-    out << " 0 slw clip " << std::endl;
+    out << " 0 slw clip " << '\n';
   }
 
   // Draw the background color if needed.
@@ -618,17 +721,35 @@ void Board::saveEPS(std::ostream & out, double pageWidth, double pageHeight, dou
     LibBoard::rectangle(bbox, Color::Null, _backgroundColor, 0.0).flushPostscript(out, transform);
   }
 
-  for (const Shape * shape : _shapes) {
-    shape->flushPostscript(out, transform);
+  if (clipping) {
+    // A shape entirely outside the clipping path would be fully formatted
+    // only for the PostScript interpreter to discard it: reject it here on
+    // a conservative bounding-box test instead.
+    const Rect & clip = clipBox;
+    for (const Shape * shape : _shapes) {
+      const Rect b = shape->boundingBox(UseLineWidth);
+      if (b.left > clip.right() || b.right() < clip.left || b.bottom() > clip.top || b.top < clip.bottom()) {
+        continue;
+      }
+      shape->flushPostscript(out, transform);
+    }
+  } else {
+    for (const Shape * shape : _shapes) {
+      shape->flushPostscript(out, transform);
+    }
   }
-  out << "showpage" << std::endl;
-  out << "%%Trailer" << std::endl;
-  out << "%EOF" << std::endl;
+  out << "showpage" << '\n';
+  out << "%%Trailer" << '\n';
+  out << "%EOF" << '\n';
+  out.imbue(previousLocale);
 }
 
 void Board::saveEPS(const char * filename, double pageWidth, double pageHeight, double margin, Unit unit, const std::string & title) const
 {
-  std::ofstream out(filename);
+  std::ofstream out;
+  char buffer[65536]; // A large stream buffer: fewer write syscalls on big figures.
+  out.rdbuf()->pubsetbuf(buffer, sizeof(buffer));
+  out.open(filename);
   saveEPS(out, pageWidth, pageHeight, margin, unit, title);
   out.close();
 }
@@ -653,6 +774,7 @@ void Board::saveFIG(std::ostream & out, PageSize size, double margin, Unit unit)
 
 void Board::saveFIG(std::ostream & out, double pageWidth, double pageHeight, double margin, Unit unit) const
 {
+  const std::locale previousLocale = out.imbue(std::locale::classic());
   Rect bbox = boundingBox(UseLineWidth);
   TransformFIG transform;
 
@@ -684,26 +806,26 @@ void Board::saveFIG(std::ostream & out, double pageWidth, double pageHeight, dou
   colormap[Color(255, 255, 0)] = 6;
   colormap[Color(255, 255, 255)] = 7;
 
-  PenColorExtractor penColorExtractor;
-  accept(penColorExtractor);
-  FillColorExtractor fillColorExtractor;
-  accept(fillColorExtractor);
+  PenAndFillColorExtractor colorExtractor; // Both color sets in one traversal of the tree.
+  accept(colorExtractor);
 
   // TODO : Color quantization
 
-  for (const Color & color : penColorExtractor.colors()) {
-    if (colormap.find(color) == colormap.end() && color.valid()) {
-      colormap[color] = maxColor++;
+  // A single insert per color: if the color is already mapped the insert is
+  // a no-op and maxColor is left alone, so no find-then-insert double walk.
+  for (const Color & color : colorExtractor.penColors()) {
+    if (color.valid() && colormap.insert(std::make_pair(color, maxColor)).second) {
+      ++maxColor;
     }
   }
-  for (const Color & color : fillColorExtractor.colors()) {
-    if (colormap.find(color) == colormap.end() && color.valid()) {
-      colormap[color] = maxColor++;
+  for (const Color & color : colorExtractor.fillColors()) {
+    if (color.valid() && colormap.insert(std::make_pair(color, maxColor)).second) {
+      ++maxColor;
     }
   }
 
-  if (colormap.find(_backgroundColor) == colormap.end() && _backgroundColor.valid()) {
-    colormap[_backgroundColor] = maxColor++;
+  if (_backgroundColor.valid() && colormap.insert(std::make_pair(_backgroundColor, maxColor)).second) {
+    ++maxColor;
   }
 
   // Write the colormap
@@ -711,8 +833,8 @@ void Board::saveFIG(std::ostream & out, double pageWidth, double pageHeight, dou
   std::map<Color, int>::const_iterator endColormap = colormap.end();
   char colorString[255];
   while (iColormap != endColormap) {
-    secured_sprintf(colorString, 255, "0 %d #%02x%02x%02x\n", iColormap->second, iColormap->first.red(), iColormap->first.green(), iColormap->first.blue());
-    if (iColormap->second >= 32) {
+    if (iColormap->second >= 32) { // The first 32 indices are FIG's built-in colors: no line to format.
+      secured_sprintf(colorString, 255, "0 %d #%02x%02x%02x\n", iColormap->second, iColormap->first.red(), iColormap->first.green(), iColormap->first.blue());
       out << colorString;
     }
     ++iColormap;
@@ -727,25 +849,28 @@ void Board::saveFIG(std::ostream & out, double pageWidth, double pageHeight, dou
   // Draw the shapes.
   // FIXME : Handle depth
 
-  std::vector<ShapeRectDepth> depths;
+  const std::size_t leafCount = deepSize();
+  std::vector<Rect> placedBoxes;
+  std::vector<unsigned int> placedDepths;
+  placedBoxes.reserve(leafCount);
+  placedDepths.reserve(leafCount);
+  DepthGrid grid(bbox, leafCount);
+  std::unordered_map<const Shape *, unsigned int> depthMap;
+  depthMap.reserve(leafCount);
   unsigned int minDepth = std::numeric_limits<unsigned int>::max();
-  ConstLeafVisitor::Function countShapes = [&depths, &minDepth](const Shape & shape) { //
-    const Rect bbox = shape.bbox(UseLineWidth);
-    const unsigned int depth = findNextDepth(bbox, depths);
-    const ShapeRectDepth srd{&shape, bbox, depth};
-    depths.emplace_back(srd);
+  ConstLeafVisitor::Function countShapes = [&placedBoxes, &placedDepths, &grid, &depthMap, &minDepth](const Shape & shape) { //
+    const Rect shapeBox = shape.bbox(UseLineWidth);
+    const unsigned int depth = grid.nextDepth(shapeBox, placedBoxes, placedDepths);
+    placedBoxes.push_back(shapeBox);
+    placedDepths.push_back(depth);
+    grid.insert(placedBoxes.size() - 1, shapeBox);
+    depthMap[&shape] = depth;
     if (depth < minDepth) {
       minDepth = depth;
     }
   };
   ConstLeafVisitor visitor(countShapes);
   accept(visitor);
-
-  std::map<const Shape *, unsigned int> depthMap;
-  for (const auto & srd : depths) {
-    depthMap[srd.shape] = srd.depth;
-  }
-  depths.clear();
   transform.setDepthMap(&depthMap, minDepth);
 
   // std::cout << depthMap.size() << " leaves\n";
@@ -753,11 +878,15 @@ void Board::saveFIG(std::ostream & out, double pageWidth, double pageHeight, dou
   for (const Shape * shape : _shapes) {
     shape->flushFIG(out, transform, colormap);
   }
+  out.imbue(previousLocale);
 }
 
 void Board::saveFIG(const char * filename, double pageWidth, double pageHeight, double margin, Unit unit) const
 {
-  std::ofstream out(filename);
+  std::ofstream out;
+  char buffer[65536]; // A large stream buffer: fewer write syscalls on big figures.
+  out.rdbuf()->pubsetbuf(buffer, sizeof(buffer));
+  out.open(filename);
   saveFIG(out, pageWidth, pageHeight, margin, unit);
   out.close();
 }
@@ -782,41 +911,51 @@ void Board::saveSVG(std::ostream & out, PageSize size, double margin, Unit unit)
 
 void Board::saveSVG(const char * filename, double pageWidth, double pageHeight, double margin, Unit unit) const
 {
-  std::ofstream out(filename);
+  std::ofstream out;
+  char buffer[65536]; // A large stream buffer: fewer write syscalls on big figures.
+  out.rdbuf()->pubsetbuf(buffer, sizeof(buffer));
+  out.open(filename);
   saveSVG(out, pageWidth, pageHeight, margin, unit);
   out.close();
 }
 
 void Board::saveSVG(std::ostream & out, double pageWidth, double pageHeight, double margin, Unit unit) const
 {
+  const std::locale previousLocale = out.imbue(std::locale::classic());
   Rect bbox = boundingBox(UseLineWidth);
   TransformSVG transform;
   bool clipping = _clippingPath.size() > 2;
+  Rect clipBox; // As in saveEPS: one bounding-box computation shared with the cull loop.
   if (clipping) {
-    bbox = bbox && _clippingPath.boundingBox();
+    clipBox = _clippingPath.boundingBox();
+    bbox = bbox && clipBox;
   }
 
-  out << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\" standalone=\"no\"?>" << std::endl;
-  out << "<!DOCTYPE svg PUBLIC \"-//W3C//DTD SVG 1.1//EN\"" << std::endl;
-  out << " \"http://www.w3.org/Graphics/SVG/1.1/DTD/svg11.dtd\">" << std::endl;
+  out << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\" standalone=\"no\"?>" << '\n';
+  out << "<!DOCTYPE svg PUBLIC \"-//W3C//DTD SVG 1.1//EN\"" << '\n';
+  out << " \"http://www.w3.org/Graphics/SVG/1.1/DTD/svg11.dtd\">" << '\n';
 
   if (pageWidth == 0.0 && pageHeight == 0.0) {
     transform.setBoundingBox(bbox, toMillimeter(bbox.width, unit), toMillimeter(bbox.height, unit), -toMillimeter(margin, unit));
-    out << "<svg width=\"" << toMillimeter(bbox.width + 2 * margin, unit) << "mm"
-        << "\" height=\"" << toMillimeter(bbox.height + 2 * margin, unit) << "mm"
-        << "\" " << std::endl;
-    out << "     viewBox=\"0 0 " << toMillimeter(bbox.width + 2 * margin, unit) * ppmm << " " << toMillimeter(bbox.height + 2 * margin, unit) * ppmm << "\" " << std::endl;
+    const double widthMM = toMillimeter(bbox.width + 2 * margin, unit);
+    const double heightMM = toMillimeter(bbox.height + 2 * margin, unit);
+    out << "<svg width=\"" << widthMM << "mm"
+        << "\" height=\"" << heightMM << "mm"
+        << "\" " << '\n';
+    out << "     viewBox=\"0 0 " << widthMM * ppmm << " " << heightMM * ppmm << "\" " << '\n';
     out << "     xmlns=\"http://www.w3.org/2000/svg\""
         << " xmlns:xlink=\"http://www.w3.org/1999/xlink\""
-        << " version=\"1.1\" >" << std::endl;
+        << " version=\"1.1\" >" << '\n';
   } else {
     transform.setBoundingBox(bbox, toMillimeter(pageWidth, unit), toMillimeter(pageHeight, unit), toMillimeter(margin, unit));
 
-    out << "<svg width=\"" << toMillimeter(pageWidth, unit) << "mm\" height=\"" << toMillimeter(pageHeight, unit) << "mm\" " << std::endl;
-    out << "     viewBox=\"0 0 " << toMillimeter(pageWidth, unit) * ppmm << " " << toMillimeter(pageHeight, unit) * ppmm << "\" " << std::endl;
+    const double widthMM = toMillimeter(pageWidth, unit);
+    const double heightMM = toMillimeter(pageHeight, unit);
+    out << "<svg width=\"" << widthMM << "mm\" height=\"" << heightMM << "mm\" " << '\n';
+    out << "     viewBox=\"0 0 " << widthMM * ppmm << " " << heightMM * ppmm << "\" " << '\n';
     out << "     xmlns=\"http://www.w3.org/2000/svg\""
         << " xmlns:xlink=\"http://www.w3.org/1999/xlink\""
-        << " version=\"1.1\" >" << std::endl;
+        << " version=\"1.1\" >" << '\n';
   }
 
   out << "<desc>"
@@ -824,7 +963,7 @@ void Board::saveSVG(std::ostream & out, double pageWidth, double pageHeight, dou
       << BOARD_VERSION_STRING
       << ") Copyright Sebastien Fourey"
          "</desc>"
-      << std::endl;
+      << '\n';
 
   if (clipping) {
     out << "<g clip-rule=\"nonzero\">\n"
@@ -843,14 +982,28 @@ void Board::saveSVG(std::ostream & out, double pageWidth, double pageHeight, dou
   }
 
   // Draw the shapes.
-  for (const Shape * shape : _shapes) {
-    shape->flushSVG(out, transform);
+  if (clipping) {
+    // As in saveEPS: shapes entirely outside the clipping path would be
+    // serialised only to be cropped away, so reject them on their boxes.
+    const Rect & clip = clipBox;
+    for (const Shape * shape : _shapes) {
+      const Rect b = shape->boundingBox(UseLineWidth);
+      if (b.left > clip.right() || b.right() < clip.left || b.bottom() > clip.top || b.top < clip.bottom()) {
+        continue;
+      }
+      shape->flushSVG(out, transform);
+    }
+  } else {
+    for (const Shape * shape : _shapes) {
+      shape->flushSVG(out, transform);
+    }
   }
 
   if (clipping) {
     out << "</g>\n</g>";
   }
-  out << "</svg>" << std::endl;
+  out << "</svg>" << '\n';
+  out.imbue(previousLocale);
 }
 
 void Board::saveTikZ(const char * filename, PageSize size, double margin) const
@@ -865,14 +1018,18 @@ void Board::saveTikZ(std::ostream & out, PageSize size, double margin) const
 
 void Board::saveTikZ(std::ostream & out, double pageWidth, double pageHeight, double margin) const
 {
+  const std::locale previousLocale = out.imbue(std::locale::classic());
   TransformTikZ transform;
   Rect box = boundingBox(UseLineWidth);
   bool clipping = _clippingPath.size() > 2;
-  if (clipping)
-    box = box && _clippingPath.boundingBox();
+  Rect clipBox; // As in saveEPS: one bounding-box computation shared with the cull loop.
+  if (clipping) {
+    clipBox = _clippingPath.boundingBox();
+    box = box && clipBox;
+  }
   transform.setBoundingBox(box, pageWidth, pageHeight, margin);
 
-  out << "\\begin{tikzpicture}[anchor=south west,text depth=0,x={(1pt,0pt)},y={(0pt,-1pt)}]" << std::endl;
+  out << "\\begin{tikzpicture}[anchor=south west,text depth=0,x={(1pt,0pt)},y={(0pt,-1pt)}]" << '\n';
 
   if (clipping) {
     out << "\\clip ";
@@ -886,11 +1043,23 @@ void Board::saveTikZ(std::ostream & out, double pageWidth, double pageHeight, do
   }
 
   // Draw the shapes.
-  for (const Shape * shape : _shapes) {
-    shape->flushTikZ(out, transform);
+  if (clipping) {
+    const Rect & clip = clipBox;
+    for (const Shape * shape : _shapes) {
+      const Rect b = shape->boundingBox(UseLineWidth);
+      if (b.left > clip.right() || b.right() < clip.left || b.bottom() > clip.top || b.top < clip.bottom()) {
+        continue;
+      }
+      shape->flushTikZ(out, transform);
+    }
+  } else {
+    for (const Shape * shape : _shapes) {
+      shape->flushTikZ(out, transform);
+    }
   }
 
-  out << "\\end{tikzpicture}" << std::endl;
+  out << "\\end{tikzpicture}" << '\n';
+  out.imbue(previousLocale);
 }
 
 Rect Board::pageRect(PageSize size, Unit unit)
@@ -911,26 +1080,12 @@ Rect Board::pageRect(PageSize size, Unit unit)
   return Rect{0, 0, 0, 0};
 }
 
-double Board::toMillimeter(double x, Unit unit)
-{
-  // enum class Unit { Point, Inch, Centimeter, Millimeter };
-  switch (unit) {
-  case Unit::Point:
-    return x * 25.4 / 72.0;
-  case Unit::Inch:
-    return x * 25.4;
-  case Unit::Centimeter:
-    return x * 10.0;
-  case Unit::Millimeter:
-    return x;
-  }
-  Tools::error << "toMillimeter(): bad unit (" << int(unit) << ")\n";
-  return 0;
-}
-
 void Board::saveTikZ(const char * filename, double pageWidth, double pageHeight, double margin) const
 {
-  std::ofstream out(filename);
+  std::ofstream out;
+  char buffer[65536]; // A large stream buffer: fewer write syscalls on big figures.
+  out.rdbuf()->pubsetbuf(buffer, sizeof(buffer));
+  out.open(filename);
   saveTikZ(out, pageWidth, pageHeight, margin);
   out.close();
 }
@@ -969,18 +1124,19 @@ Group grid(Point topLeft, size_t columns, size_t rows, //
            Color penColor, Color fillColor, double lineWidth, const LineStyle lineStyle, const LineCap cap, const LineJoin join)
 {
   Group group;
-  double cellSide = width / double(columns);
+  group.reserve(columns + rows + 1);
   group << rectangle(topLeft.x, topLeft.y, width, height, penColor, fillColor, lineWidth, lineStyle, cap, join);
-  Line vLine(topLeft.x + cellSide, topLeft.y, topLeft.x + cellSide, topLeft.y - height, penColor, lineWidth, lineStyle, RoundCap, join);
-  while (--columns) {
-    group << vLine;
-    vLine.translate(cellSide, 0);
+  // Compute each line position directly instead of sliding a template line:
+  // no accumulated rounding over the cells, and no transform calls.
+  const double cellWidth = width / double(columns);
+  for (size_t i = 1; i < columns; ++i) {
+    const double x = topLeft.x + i * cellWidth;
+    group << Line(x, topLeft.y, x, topLeft.y - height, penColor, lineWidth, lineStyle, RoundCap, join);
   }
-  cellSide = height / double(rows);
-  Line hLine(topLeft.x, topLeft.y - cellSide, topLeft.x + width, topLeft.y - cellSide, penColor, lineWidth, lineStyle, RoundCap, join);
-  while (--rows) {
-    group << hLine;
-    hLine.translate(0, -cellSide);
+  const double cellHeight = height / double(rows);
+  for (size_t i = 1; i < rows; ++i) {
+    const double y = topLeft.y - i * cellHeight;
+    group << Line(topLeft.x, y, topLeft.x + width, y, penColor, lineWidth, lineStyle, RoundCap, join);
   }
   return group;
 }
@@ -997,17 +1153,26 @@ Group tiling(const Shape & shape, Point topLeftCorner, int columns, int rows, do
   Group group;
   if (columns && rows) {
     Rect box = shape.boundingBox(lineWidthFlag);
-    Shape * topLeft = shape.clone();
-    topLeft->translate(topLeftCorner.x - box.left, topLeftCorner.y - box.top);
+    Shape * cursor = shape.clone();
+    cursor->translate(topLeftCorner.x - box.left, topLeftCorner.y - box.top);
+    group.reserve(static_cast<std::size_t>(columns) * rows);
+    const double stepX = box.width + spacing;
+    const double stepY = box.height + spacing;
+    // Walk a single cursor shape across the cells: operator<< clones on
+    // insertion, so moving the cursor by one step per cell replaces the
+    // clone/translate/delete a fresh copy per cell used to cost.
     for (int r = 0; r < rows; ++r) {
       for (int c = 0; c < columns; ++c) {
-        Shape * shape = topLeft->clone();
-        shape->translate(c * (box.width + spacing), -r * (box.height + spacing));
-        group << (*shape);
-        delete shape;
+        group << (*cursor);
+        if (c + 1 < columns) {
+          cursor->translate(stepX, 0.0);
+        }
+      }
+      if (r + 1 < rows) {
+        cursor->translate((1 - columns) * stepX, -stepY);
       }
     }
-    delete topLeft;
+    delete cursor;
   }
   return group;
 }
@@ -1032,6 +1197,9 @@ Group cross(Point p, const Style & style)
 Polyline bezierControls(const Bezier & bezier, const Style & style)
 {
   std::vector<Point> path;
+  if (bezier.path().size() > 1) {
+    path.reserve(3 * (bezier.path().size() - 1) + 1); // Three points per segment plus the final endpoint.
+  }
   std::vector<Point>::const_iterator iPoint = bezier.path().points().begin();
   std::vector<Point>::const_iterator endPoint = bezier.path().points().end();
   std::vector<Point>::const_iterator iControl = bezier.controls().begin();
@@ -1063,15 +1231,35 @@ Group array(Point topLeft, const std::vector<Color> & colors, //
   Group result;
   Style style(Color::Null, Color::Null, lineWidth, SolidStyle, SquareCap, MiterJoin);
   const bool WithLine = (lineWidth != 0.0);
+  if (!WithLine) {
+    // Without a pen, a run of equal-colored cells is indistinguishable from
+    // one wider rectangle: merge each row's runs so flat color grids cost
+    // one shape per run instead of one per cell.
+    for (unsigned int i = 0; i < rows; i++) {
+      const double y = topLeft.y - i * pixelHeight;
+      const unsigned int skip_lines = i * columns;
+      unsigned int j = 0;
+      while (j < columns) {
+        const Color & color = colors[j + skip_lines];
+        unsigned int run = 1;
+        while (j + run < columns && colors[j + run + skip_lines] == color) {
+          ++run;
+        }
+        style.fillColor = color;
+        result << rectangle(topLeft.x + j * pixelWidth, y, run * pixelWidth, pixelHeight, style);
+        j += run;
+      }
+    }
+    return result;
+  }
+  result.reserve(rows * columns);
   for (unsigned int i = 0; i < rows; i++) {
     const double y = topLeft.y - i * pixelHeight;
     const unsigned int skip_lines = i * columns;
     for (unsigned int j = 0; j < columns; j++) {
       const double x = topLeft.x + j * pixelWidth;
       style.fillColor = colors[j + skip_lines];
-      if (WithLine) {
-        style.penColor = style.fillColor;
-      }
+      style.penColor = style.fillColor;
       result << rectangle(x, y, pixelWidth, pixelHeight, style);
     }
   }
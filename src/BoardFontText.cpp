@@ -28,6 +28,7 @@
 #include <cassert>
 #include <cstdio>
 #include <cstring>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -114,13 +115,18 @@ const LibBoard::ShapeList & fontGlyph(int c)
 
 vector<string> split(const string & str, const char * delimiters)
 {
+  // Scan the string directly rather than strtok'ing a writable copy: no
+  // intermediate buffer, reentrant, and an all-delimiter input yields an
+  // empty vector instead of a null token.
   vector<string> result;
-  vector<char> buffer(str.c_str(), str.c_str() + str.length());
-  buffer.emplace_back('\0');
-  result.emplace_back(strtok(buffer.data(), delimiters));
-  char * pc;
-  while ((pc = strtok(nullptr, delimiters))) {
-    result.emplace_back(pc);
+  string::size_type position = str.find_first_not_of(delimiters, 0);
+  while (position != string::npos) {
+    string::size_type end = str.find_first_of(delimiters, position);
+    if (end == string::npos) {
+      end = str.length();
+    }
+    result.emplace_back(str, position, end - position);
+    position = str.find_first_not_of(delimiters, end);
   }
   return result;
 }
@@ -215,6 +221,8 @@ void parseSVGPath(const std::string & text, ShapeList & paths)
   std::vector<string> tokens = split(text, " ");
   std::vector<Point> points;
   std::vector<Point> controls;
+  points.reserve(tokens.size()); // At most one point (or control pair) per token.
+  controls.reserve(tokens.size());
 
   bool absolute = false;
   char mode = 'l';
@@ -322,15 +330,22 @@ Group boardFontText(Point baselineStart, const std::string & text, double size,
   Group group;
   double x = baselineStart.x;
   double y = baselineStart.y;
+  // Scale each distinct character once: repeated characters reuse the scaled
+  // glyph and its box instead of rescaling the shape list per occurrence.
+  std::map<char, std::pair<ShapeList, Rect>> scaledGlyphs;
   for (const char c : text) {
-    LSHOW(c);
     if (c == ' ') {
       x += 0.7 * size;
       continue;
     }
-    const ShapeList & g = fontGlyph(c);
-    ShapeList list = g.scaled(size);
-    Rect box = list.boundingBox(IgnoreLineWidth);
+    auto it = scaledGlyphs.find(c);
+    if (it == scaledGlyphs.end()) {
+      ShapeList scaled = fontGlyph(c).scaled(size);
+      const Rect box = scaled.boundingBox(IgnoreLineWidth);
+      it = scaledGlyphs.insert(std::make_pair(c, std::make_pair(std::move(scaled), box))).first;
+    }
+    ShapeList list = it->second.first;
+    const Rect & box = it->second.second;
     list.translate(x - box.left, y + glyph_vshift(c) * size - box.bottom());
     group << list;
     x += 1.1 * glyph_width(c) * size + lineWidth;
@@ -65,7 +65,9 @@ Dot & Dot::rotate(double angle, const Point & center)
 
 Dot Dot::rotated(double angle, const Point & center) const
 {
-  return Dot(*this).rotate(angle, center);
+  Dot result(*this);
+  result.rotate(angle, center);
+  return result;
 }
 
 Dot & Dot::rotate(double)
@@ -87,7 +89,9 @@ Dot & Dot::translate(double dx, double dy)
 
 Dot Dot::translated(double dx, double dy) const
 {
-  return Dot(*this).translate(dx, dy);
+  Dot result(*this);
+  result.translate(dx, dy);
+  return result;
 }
 
 Dot & Dot::scale(double, double)
@@ -122,7 +126,7 @@ void Dot::flushPostscript(std::ostream & stream, const TransformEPS & transform)
   stream << _style.postscriptProperties(transform) << " "
          << "n " << transform.mapX(_x) << " " << transform.mapY(_y) << " "
          << "m " << transform.mapX(_x) << " " << transform.mapY(_y) << " "
-         << "l " << penColor().postscript() << " srgb stroke" << std::endl;
+         << "l " << penColor().postscript() << " srgb stroke" << '\n';
 }
 
 void Dot::flushFIG(std::ostream & stream, const TransformFIG & transform, std::map<Color, int> & colormap) const
@@ -144,7 +148,7 @@ void Dot::flushFIG(std::ostream & stream, const TransformFIG & transform, std::m
   stream << "2\n";
   stream << "         ";
   stream << static_cast<int>(transform.mapX(_x)) << " " << static_cast<int>(transform.mapY(_y)) << " " << static_cast<int>(transform.mapX(_x)) << " " << static_cast<int>(transform.mapY(_y))
-         << std::endl;
+         << '\n';
 }
 
 void Dot::flushSVG(std::ostream & stream, const TransformSVG & transform) const
@@ -152,14 +156,15 @@ void Dot::flushSVG(std::ostream & stream, const TransformSVG & transform) const
   stream << "<line x1=\"" << transform.mapX(_x) << "\""
          << " y1=\"" << transform.mapY(_y) << "\""
          << " x2=\"" << transform.mapX(_x) << "\""
-         << " y2=\"" << transform.mapY(_y) << "\"" << _style.svgProperties(transform) << " />" << std::endl;
+         << " y2=\"" << transform.mapY(_y) << "\"" << _style.svgProperties(transform) << " />" << '\n';
 }
 
-void Dot::flushTikZ(std::ostream & stream, const TransformTikZ & /*transform*/) const
+void Dot::flushTikZ(std::ostream & stream, const TransformTikZ & transform) const
 
 {
-  // FIXME: unimplemented
-  stream << "% FIXME: Dot::flushTikZ unimplemented" << std::endl;
+  // A dot is a zero-length segment, as in the EPS and SVG outputs: the
+  // line cap makes it visible.
+  stream << "\\path[" << _style.tikzProperties(transform) << "] (" << transform.mapX(_x) << ',' << transform.mapY(_y) << ") -- (" << transform.mapX(_x) << ',' << transform.mapY(_y) << ");" << '\n';
 }
 
 void Dot::accept(ShapeVisitor & visitor)
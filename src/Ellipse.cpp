@@ -71,7 +71,9 @@ Ellipse & Ellipse::rotate(double angle, const Point & center)
 
 Ellipse Ellipse::rotated(double angle, const Point & center) const
 {
-  return Ellipse(*this).rotate(angle, center);
+  Ellipse result(*this);
+  result.rotate(angle, center);
+  return result;
 }
 
 Ellipse & Ellipse::rotate(double angle)
@@ -81,7 +83,9 @@ Ellipse & Ellipse::rotate(double angle)
 
 Ellipse Ellipse::rotated(double angle) const
 {
-  return Ellipse(*this).rotate(angle, center());
+  Ellipse result(*this);
+  result.rotate(angle, center());
+  return result;
 }
 
 Ellipse & Ellipse::translate(double dx, double dy)
@@ -92,16 +96,25 @@ Ellipse & Ellipse::translate(double dx, double dy)
 
 Ellipse Ellipse::translated(double dx, double dy) const
 {
-  return Ellipse(*this).translate(dx, dy);
+  Ellipse result(*this);
+  result.translate(dx, dy);
+  return result;
 }
 
 Ellipse & Ellipse::scale(double sx, double sy)
 {
   // Thanks to Freddie Exall for pointing an error with the first version
   // of this function, and for pointing to a fix as well!
+  if (sx == sy) {
+    // Uniform scaling preserves the axes whatever the rotation angle.
+    _xRadius *= sx;
+    _yRadius *= sy;
+    updateLineWidth(sx);
+    return *this;
+  }
   if (!Tools::almostEqual(_angle, 0.0)) {
-    const double co = cos(_angle);
-    const double si = sin(_angle);
+    double si, co;
+    Tools::sincos(_angle, si, co);
 
     // current transformation matrix
     const double m00 = (1 / _xRadius) * co;
@@ -152,12 +165,16 @@ Ellipse & Ellipse::scale(double s)
 
 Ellipse Ellipse::scaled(double sx, double sy) const
 {
-  return Ellipse(*this).scale(sx, sy);
+  Ellipse result(*this);
+  result.scale(sx, sy);
+  return result;
 }
 
 Ellipse Ellipse::scaled(double s) const
 {
-  return Ellipse(*this).scale(s, s);
+  Ellipse result(*this);
+  result.scale(s, s);
+  return result;
 }
 
 void Ellipse::scaleAll(double s)
@@ -169,7 +186,9 @@ void Ellipse::scaleAll(double s)
 
 Ellipse Ellipse::resized(double w, double h, LineWidthFlag lineWidthFlag) const
 {
-  return static_cast<Ellipse &>(Ellipse(*this).resize(w, h, lineWidthFlag));
+  Ellipse result(*this);
+  result.resize(w, h, lineWidthFlag);
+  return result;
 }
 
 Ellipse * Ellipse::clone() const
@@ -184,15 +203,32 @@ void Ellipse::setCircleFlag()
 
 double Ellipse::perimeter() const
 {
-  double theta = 0.0;
-  double dTheta = 0.0001;
-  double numIntegrals = std::round(2.0 * M_PI / dTheta);
-  double result = 0.0;
-  for (int i = 0; i < numIntegrals; ++i) {
-    theta += i * dTheta;
-    result += std::hypot(_xRadius * sin(theta), _yRadius * cos(theta)); // result += dpt
+  // Gauss arithmetic-geometric-mean evaluation of the complete elliptic
+  // integral of the second kind: quadratic convergence, so full double
+  // precision is reached within a handful of iterations and no trigonometric
+  // call, where the previous numerical integration sampled tens of
+  // thousands of angles.
+  const double a = std::max(_xRadius, _yRadius);
+  const double b = std::min(_xRadius, _yRadius);
+  if (b == 0.0) {
+    return 4 * a;
+  }
+  double x = a;
+  double y = b;
+  double sum = 0.5 * (a * a - b * b);
+  double power = 0.5;
+  int iteration = 0;
+  while (std::fabs(x - y) > 1e-15 * x && iteration < 30) {
+    const double nextX = 0.5 * (x + y);
+    const double nextY = std::sqrt(x * y);
+    const double c = 0.5 * (x - y);
+    power *= 2;
+    sum += power * c * c;
+    x = nextX;
+    y = nextY;
+    ++iteration;
   }
-  return result * dTheta;
+  return 2 * M_PI * (a * a - sum) / x;
 }
 
 Path Ellipse::sampledPath(int n, SamplingStart start) const
@@ -218,16 +254,21 @@ Path Ellipse::sampledPath(int n, SamplingStart start) const
     theta = -M_PI / 2.0;
     break;
   }
+  path.reserve(static_cast<std::size_t>(n) + 1);
   for (int i = 0; i < numIntegrals; i++) {
     theta += dTheta;
+    // One fused sine/cosine evaluation feeds both the sampled point and the
+    // arc-length increment below.
+    double sinTheta, cosTheta;
+    Tools::sincos(theta, sinTheta, cosTheta);
     double subIntegral = n * run / circ;
     if (static_cast<int>(subIntegral) >= nextPoint) {
-      double x = _xRadius * cos(theta);
-      double y = _yRadius * sin(theta);
+      double x = _xRadius * cosTheta;
+      double y = _yRadius * sinTheta;
       path.push_back(Point(x, y).rotated(_angle, _center));
       ++nextPoint;
     }
-    run += std::hypot(_xRadius * sin(theta), _yRadius * cos(theta)) * dTheta; // run += dpt
+    run += std::hypot(_xRadius * sinTheta, _yRadius * cosTheta) * dTheta; // run += dpt
   }
   path.pop_back();
   path.moveCenter(_center);
@@ -241,20 +282,21 @@ bool Ellipse::isACircle() const
 
 void Ellipse::flushPostscript(std::ostream & stream, const TransformEPS & transform) const
 {
-  double yScale = _yRadius / _xRadius;
+  const double yScale = _yRadius / _xRadius;
+  const bool circle = isACircle();
   stream << "\n% Ellipse\n";
   if (filled()) {
     stream << "gs " << transform.mapX(_center.x) << " " << transform.mapY(_center.y) << " tr";
     if (_angle != 0.0) {
       stream << " " << (_angle * 180 / M_PI) << " rot ";
     }
-    if (!isACircle()) {
+    if (!circle) {
       stream << " " << 1.0 << " " << yScale << " sc";
     }
     stream << " n " << transform.scale(_xRadius) << " 0 m "
            << " 0 0 " << transform.scale(_xRadius) << " 0.0 360.0 arc ";
     stream << " " << fillColor().postscript() << " srgb";
-    stream << " fill gr" << std::endl;
+    stream << " fill gr" << '\n';
   }
 
   if (penColor() != Color::Null && lineWidth() != 0.0) {
@@ -263,13 +305,13 @@ void Ellipse::flushPostscript(std::ostream & stream, const TransformEPS & transf
     if (_angle != 0.0) {
       stream << " " << (_angle * 180 / M_PI) << " rot ";
     }
-    if (!isACircle()) {
+    if (!circle) {
       stream << " " << 1.0 << " " << yScale << " sc";
     }
     stream << " n " << transform.scale(_xRadius) << " 0 m "
            << " 0 0 " << transform.scale(_xRadius) << " 0.0 360.0 arc ";
     stream << " " << penColor().postscript() << " srgb";
-    stream << " stroke gr" << std::endl;
+    stream << " stroke gr" << '\n';
   }
 }
 
@@ -290,27 +332,33 @@ void Ellipse::flushFIG(std::ostream & stream, const TransformFIG & transform, st
   } else {
     stream << transform.shapeDepth(this) << " -1 -1 " << (lineStyle() ? "4.000 " : "0.000 ") << " 1 " << _angle << " ";
   }
-  stream << static_cast<int>(transform.mapX(_center.x)) << " " << static_cast<int>(transform.mapY(_center.y)) << " " << static_cast<int>(transform.scale(_xRadius)) << " "
-         << static_cast<int>(transform.scale(_yRadius)) << " " << static_cast<int>(transform.mapX(_center.x)) << " " << static_cast<int>(transform.mapY(_center.y)) << " "
-         << static_cast<int>(transform.mapX(_center.x) + transform.scale(_xRadius)) << " " << static_cast<int>(transform.mapY(_center.y)) << "\n";
+  const double cx = transform.mapX(_center.x);
+  const double cy = transform.mapY(_center.y);
+  const double rx = transform.scale(_xRadius);
+  const double ry = transform.scale(_yRadius);
+  stream << static_cast<int>(cx) << " " << static_cast<int>(cy) << " " << static_cast<int>(rx) << " "
+         << static_cast<int>(ry) << " " << static_cast<int>(cx) << " " << static_cast<int>(cy) << " "
+         << static_cast<int>(cx + rx) << " " << static_cast<int>(cy) << "\n";
 }
 
 void Ellipse::flushSVG(std::ostream & stream, const TransformSVG & transform) const
 {
-  stream << "<ellipse cx=\"" << transform.mapX(_center.x) << '"' << " cy=\"" << transform.mapY(_center.y) << '"' << " rx=\"" << transform.scale(_xRadius) << '"' << " ry=\""
+  const double cx = transform.mapX(_center.x);
+  const double cy = transform.mapY(_center.y);
+  stream << "<ellipse cx=\"" << cx << '"' << " cy=\"" << cy << '"' << " rx=\"" << transform.scale(_xRadius) << '"' << " ry=\""
          << transform.scale(_yRadius) << '"' << _style.svgProperties(transform);
   if (_angle != 0.0) {
-    stream << " transform=\"rotate( " << -(_angle * 180 / M_PI) << ", " << transform.mapX(_center.x) << ", " << transform.mapY(_center.y) << " )\" ";
+    stream << " transform=\"rotate( " << -(_angle * 180 / M_PI) << ", " << cx << ", " << cy << " )\" ";
   }
-  stream << " />" << std::endl;
+  stream << " />" << '\n';
 }
 
 void Ellipse::flushTikZ(std::ostream & stream, const TransformTikZ & transform) const
 {
   // FIXME: unimplemented
-  stream << "% FIXME: Ellipse::flushTikZ unimplemented" << std::endl;
+  stream << "% FIXME: Ellipse::flushTikZ unimplemented" << '\n';
   stream << "\\path[" << _style.tikzProperties(transform) << "] (" << transform.mapX(_center.x) << ',' << transform.mapY(_center.y) << ')' << " circle [x radius=" << transform.scale(_xRadius) << ','
-         << "y radius=" << transform.scale(_yRadius) << ',' << "rotate=" << -(_angle * 180 / M_PI) << "];" << std::endl;
+         << "y radius=" << transform.scale(_yRadius) << ',' << "rotate=" << -(_angle * 180 / M_PI) << "];" << '\n';
 }
 
 void Ellipse::accept(ShapeVisitor & visitor)
@@ -349,18 +397,15 @@ Rect Ellipse::boundingBox(LineWidthFlag lineWidthFlag) const
   if (_angle == 0.0) {
     box = Rect(_center.x - _xRadius, _center.y + _yRadius, 2 * _xRadius, 2 * _yRadius);
   } else {
-    double angleXmax = -atan((_yRadius / _xRadius) * (tan(_angle)));
-    double angleXmin = angleXmax + M_PI;
-    double angleYmax = atan((_yRadius / _xRadius) * (1 / tan(_angle)));
-    double angleYmin = angleYmax + M_PI;
-    if (_angle < 0.0) {
-      angleYmax += M_PI;
-      angleYmin -= M_PI;
-    }
-    box = Rect(_center.x + _xRadius * cos(angleXmin) * cos(_angle) - _yRadius * sin(angleXmin) * sin(_angle),
-               _center.y + _xRadius * cos(angleYmax) * sin(_angle) + _yRadius * sin(angleYmax) * cos(_angle),
-               (_xRadius * cos(angleXmax) * cos(_angle) - _yRadius * sin(angleXmax) * sin(_angle)) - (_xRadius * cos(angleXmin) * cos(_angle) - _yRadius * sin(angleXmin) * sin(_angle)),
-               (_xRadius * cos(angleYmax) * sin(_angle) + _yRadius * sin(angleYmax) * cos(_angle)) - (_xRadius * cos(angleYmin) * sin(_angle) + _yRadius * sin(angleYmin) * cos(_angle)));
+    double sinAngle, cosAngle;
+    Tools::sincos(_angle, sinAngle, cosAngle);
+    // x(t) = cx + rx*cos(t)*cos(angle) - ry*sin(t)*sin(angle)
+    // y(t) = cy + rx*cos(t)*sin(angle) + ry*sin(t)*cos(angle)
+    // Injecting the extremal angles (where x'(t) = 0, resp. y'(t) = 0) into
+    // these expressions yields the classic closed form for the half extents.
+    const double halfWidth = std::sqrt(_xRadius * _xRadius * cosAngle * cosAngle + _yRadius * _yRadius * sinAngle * sinAngle);
+    const double halfHeight = std::sqrt(_xRadius * _xRadius * sinAngle * sinAngle + _yRadius * _yRadius * cosAngle * cosAngle);
+    box = Rect(_center.x - halfWidth, _center.y + halfHeight, 2 * halfWidth, 2 * halfHeight);
   }
   if (lineWidthFlag == UseLineWidth) {
     box.grow(0.5 * lineWidth());
@@ -32,10 +32,6 @@
 #include <board/ShapeVisitor.h>
 #include <board/Tools.h>
 
-#if defined(max)
-#undef max
-#endif
-
 namespace LibBoard
 {
 
@@ -134,11 +130,9 @@ void Group::setClippingRectangle(double x, double y, double width, double height
 void Group::setClippingPath(const std::vector<Point> & points)
 {
   _clippingPath.clear();
-  std::vector<Point>::const_iterator it = points.begin();
-  std::vector<Point>::const_iterator end = points.end();
-  while (it != end) {
-    _clippingPath << *it;
-    ++it;
+  _clippingPath.reserve(points.size());
+  for (const Point & point : points) {
+    _clippingPath << point;
   }
 }
 
@@ -158,7 +152,7 @@ void Group::flushPostscript(std::ostream & stream, const TransformEPS & transfor
     stream << "%%% Begin Clipped Group " << _clippingCount << "\n";
     stream << " gsave n ";
     _clippingPath.flushPostscript(stream, transform);
-    stream << " 0 slw clip " << std::endl;
+    stream << " 0 slw clip " << '\n';
     ShapeList::flushPostscript(stream, transform);
     stream << " grestore\n";
     stream << "%%% End Clipped Group " << _clippingCount << "\n";
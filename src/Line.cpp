@@ -151,7 +151,7 @@ void Line::flushPostscript(std::ostream & stream, const TransformEPS & transform
   stream << _style.postscriptProperties(transform) << " "
          << "n " << a.x << " " << a.y << " "
          << "m " << b.x << " " << b.y << " "
-         << "l " << penColor().postscript() << " srgb stroke" << std::endl;
+         << "l " << penColor().postscript() << " srgb stroke" << '\n';
 }
 
 void Line::flushFIG(std::ostream & stream, const TransformFIG & transform, std::map<Color, int> & colormap) const
@@ -177,7 +177,7 @@ void Line::flushFIG(std::ostream & stream, const TransformFIG & transform, std::
   stream << "2\n";
   stream << "         ";
   stream << static_cast<int>(a.x) << " " << static_cast<int>(a.y) << " " //
-         << static_cast<int>(b.x) << " " << static_cast<int>(b.y) << std::endl;
+         << static_cast<int>(b.x) << " " << static_cast<int>(b.y) << '\n';
 }
 
 void Line::flushSVG(std::ostream & stream, const TransformSVG & transform) const
@@ -187,14 +187,14 @@ void Line::flushSVG(std::ostream & stream, const TransformSVG & transform) const
   stream << "<line x1=\"" << a.x << "\""
          << " y1=\"" << a.y << "\""
          << " x2=\"" << b.x << "\""
-         << " y2=\"" << b.y << "\"" << _style.svgProperties(transform) << " />" << std::endl;
+         << " y2=\"" << b.y << "\"" << _style.svgProperties(transform) << " />" << '\n';
 }
 
 void Line::flushTikZ(std::ostream & stream, const TransformTikZ & transform) const
 {
   const Point a = transform.map(_a);
   const Point b = transform.map(_b);
-  stream << "\\path[" << _style.tikzProperties(transform) << "] (" << a.x << ',' << a.y << ") -- (" << b.x << ',' << b.y << ");" << std::endl;
+  stream << "\\path[" << _style.tikzProperties(transform) << "] (" << a.x << ',' << a.y << ") -- (" << b.x << ',' << b.y << ");" << '\n';
 }
 
 void Line::accept(ShapeVisitor & visitor)
@@ -26,6 +26,7 @@
 #include <BoardConfig.h>
 #include <algorithm>
 #include <board/Path.h>
+#include <board/Tools.h>
 #include <board/Transforms.h>
 #include <iterator>
 #include "BoardConfig.h"
@@ -54,7 +55,7 @@ Path & Path::operator<<(const Point & p)
 
 Path & Path::operator<<(const std::vector<Point> & v)
 {
-  std::copy(v.begin(), v.end(), std::back_inserter(_points));
+  _points.insert(_points.end(), v.begin(), v.end());
   return *this;
 }
 
@@ -76,11 +77,15 @@ Point Path::center() const
 
 Path & Path::rotate(double angle, const Point & center)
 {
-  std::vector<Point>::iterator i = _points.begin();
-  std::vector<Point>::iterator end = _points.end();
-  while (i != end) {
-    i->rotate(angle, center);
-    ++i;
+  // Evaluate the sine and cosine once for the whole path; Point::rotate
+  // would recompute them for every point.
+  double sinAngle, cosAngle;
+  Tools::sincos(angle, sinAngle, cosAngle);
+  for (Point & p : _points) {
+    const double x = p.x - center.x;
+    const double y = p.y - center.y;
+    p.x = center.x + (cosAngle * x - sinAngle * y);
+    p.y = center.y + (sinAngle * x + cosAngle * y);
   }
   return *this;
 }
@@ -93,12 +98,7 @@ Path & Path::rotateDeg(double angle, const Point & center)
 Path Path::rotated(double angle, const Point & center) const
 {
   Path res(*this);
-  std::vector<Point>::iterator i = res._points.begin();
-  std::vector<Point>::iterator end = res._points.end();
-  while (i != end) {
-    i->rotate(angle, center);
-    ++i;
-  }
+  res.rotate(angle, center);
   return res;
 }
 
@@ -254,7 +254,7 @@ void Path::flushSVGCommands(std::ostream & stream, const TransformSVG & transfor
       stream << "\n                  ";
   }
   if (isClosed()) {
-    stream << " Z" << std::endl;
+    stream << " Z" << '\n';
   }
 }
 
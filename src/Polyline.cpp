@@ -71,7 +71,9 @@ Polyline & Polyline::rotate(double angle, const Point & center)
 
 Polyline Polyline::rotated(double angle, const Point & center) const
 {
-  return Polyline(*this).rotate(angle, center);
+  Polyline result(*this);
+  result.rotate(angle, center);
+  return result;
 }
 
 Polyline & Polyline::rotate(double angle)
@@ -82,7 +84,9 @@ Polyline & Polyline::rotate(double angle)
 
 Polyline Polyline::rotated(double angle) const
 {
-  return Polyline(*this).rotate(angle, center());
+  Polyline result(*this);
+  result.rotate(angle, center());
+  return result;
 }
 
 Polyline & Polyline::translate(double dx, double dy)
@@ -98,7 +102,9 @@ Polyline & Polyline::translate(double dx, double dy)
 
 Polyline Polyline::translated(double dx, double dy) const
 {
-  return Polyline(*this).translate(dx, dy);
+  Polyline result(*this);
+  result.translate(dx, dy);
+  return result;
 }
 
 Polyline & Polyline::scale(double sx, double sy)
@@ -126,12 +132,16 @@ Polyline & Polyline::scale(double s)
 
 Polyline Polyline::scaled(double sx, double sy) const
 {
-  return Polyline(*this).scale(sx, sy);
+  Polyline result(*this);
+  result.scale(sx, sy);
+  return result;
 }
 
 Polyline Polyline::scaled(double s) const
 {
-  return Polyline(*this).scale(s, s);
+  Polyline result(*this);
+  result.scale(s, s);
+  return result;
 }
 
 void Polyline::scaleAll(double s)
@@ -146,7 +156,9 @@ void Polyline::scaleAll(double s)
 
 Polyline Polyline::resized(double w, double h, LineWidthFlag lineWidthFlag) const
 {
-  return static_cast<Polyline &>(Polyline(*this).resize(w, h, lineWidthFlag));
+  Polyline result(*this);
+  result.resize(w, h, lineWidthFlag);
+  return result;
 }
 
 void Polyline::addHole(const Path & path)
@@ -182,7 +194,7 @@ void Polyline::flushPostscript(std::ostream & stream, const TransformEPS & trans
     stream << " ";
     fillColor().flushPostscript(stream);
     stream << " " << _style.postscriptProperties(transform);
-    stream << " fill" << std::endl;
+    stream << " fill" << '\n';
   }
   if (penColor() != Color::Null && lineWidth() != 0.0) {
     stream << " " << _style.postscriptProperties(transform) << "\n";
@@ -195,7 +207,7 @@ void Polyline::flushPostscript(std::ostream & stream, const TransformEPS & trans
     }
     stream << " ";
     penColor().flushPostscript(stream);
-    stream << " stroke" << std::endl;
+    stream << " stroke" << '\n';
   }
 }
 
@@ -235,9 +247,9 @@ void Polyline::flushFIG(std::ostream & stream, const TransformFIG & transform, s
     stream << "-1 " << (lineStyle() ? "4.000 " : "0.000 ") << lineJoin() << " " << lineCap() << " -1 0 0 ";
   }
   // Number of points
-  stream << _path.size() + _path.isClosed() << std::endl;
+  stream << _path.size() + _path.isClosed() << '\n';
   _path.flushFIG(stream << "         ", transform);
-  stream << std::endl;
+  stream << '\n';
 }
 
 void Polyline::flushSVG(std::ostream & stream, const TransformSVG & transform) const
@@ -259,7 +271,7 @@ void Polyline::flushSVG(std::ostream & stream, const TransformSVG & transform) c
 
   if (_holes.size()) {
     stream << "<path";
-    stream << _style.svgProperties(transform) << std::endl;
+    stream << _style.svgProperties(transform) << '\n';
     stream << "          d=\"";
     Path p = _path.getClockwise();
     p.close();
@@ -276,12 +288,12 @@ void Polyline::flushSVG(std::ostream & stream, const TransformSVG & transform) c
     } else {
       stream << "<polyline";
     }
-    stream << _style.svgProperties(transform) << std::endl;
+    stream << _style.svgProperties(transform) << '\n';
     stream << "          points=\"";
     _path.flushSVGPoints(stream, transform);
   }
 
-  stream << "\" />" << std::endl;
+  stream << "\" />" << '\n';
 }
 
 void Polyline::flushTikZ(std::ostream & stream, const TransformTikZ & transform) const
@@ -293,7 +305,7 @@ void Polyline::flushTikZ(std::ostream & stream, const TransformTikZ & transform)
   _path.flushTikZPoints(stream, transform);
   if (_path.isClosed())
     stream << " -- cycle";
-  stream << ";" << std::endl;
+  stream << ";" << '\n';
 }
 
 void Polyline::accept(ShapeVisitor & visitor)
@@ -357,7 +369,7 @@ void Polyline::flushRectangleFIG(std::ostream & stream, const TransformFIG & tra
   }
   stream << "         ";
   _path.flushFIG(stream, transform);
-  stream << std::endl;
+  stream << '\n';
 }
 
 void Polyline::flushRectangleSVG(std::ostream & stream, const TransformSVG & transform) const
@@ -367,7 +379,7 @@ void Polyline::flushRectangleSVG(std::ostream & stream, const TransformSVG & tra
            << " y=\"" << transform.mapY(_path[0].y) << '"'                    //
            << " width=\"" << transform.scale(_path[1].x - _path[0].x) << '"'  //
            << " height=\"" << transform.scale(_path[0].y - _path[3].y) << '"' //
-           << _style.svgProperties(transform) << " />" << std::endl;
+           << _style.svgProperties(transform) << " />" << '\n';
   } else {
     Point v = _path[1] - _path[0];
     v /= v.norm();
@@ -378,7 +390,7 @@ void Polyline::flushRectangleSVG(std::ostream & stream, const TransformSVG & tra
            << " height=\"" << transform.scale((_path[0] - _path[3]).norm()) << '"' //
            << _style.svgProperties(transform) << ' '                               //
            << " transform=\"rotate(" << -angle << ", " << transform.mapX(_path[0].x) << ", " << transform.mapY(_path[0].y) << ") \" "
-           << " />" << std::endl;
+           << " />" << '\n';
   }
 }
 
@@ -442,7 +454,9 @@ GouraudTriangle & GouraudTriangle::rotate(double angle, const Point & center)
 
 GouraudTriangle GouraudTriangle::rotated(double angle, const Point & center) const
 {
-  return GouraudTriangle(*this).rotate(angle, center);
+  GouraudTriangle result(*this);
+  result.rotate(angle, center);
+  return result;
 }
 
 GouraudTriangle & GouraudTriangle::rotate(double angle)
@@ -452,22 +466,30 @@ GouraudTriangle & GouraudTriangle::rotate(double angle)
 
 GouraudTriangle GouraudTriangle::rotated(double angle) const
 {
-  return GouraudTriangle(*this).rotate(angle, center());
+  GouraudTriangle result(*this);
+  result.rotate(angle, center());
+  return result;
 }
 
 GouraudTriangle GouraudTriangle::translated(double dx, double dy) const
 {
-  return static_cast<GouraudTriangle &>(GouraudTriangle(*this).translate(dx, dy));
+  GouraudTriangle result(*this);
+  result.translate(dx, dy);
+  return result;
 }
 
 GouraudTriangle GouraudTriangle::scaled(double sx, double sy) const
 {
-  return static_cast<GouraudTriangle &>(GouraudTriangle(*this).scale(sx, sy));
+  GouraudTriangle result(*this);
+  result.scale(sx, sy);
+  return result;
 }
 
 GouraudTriangle GouraudTriangle::scaled(double s) const
 {
-  return static_cast<GouraudTriangle &>(GouraudTriangle(*this).scale(s, s));
+  GouraudTriangle result(*this);
+  result.scale(s, s);
+  return result;
 }
 
 void GouraudTriangle::scaleAll(double s)
@@ -477,7 +499,9 @@ void GouraudTriangle::scaleAll(double s)
 
 GouraudTriangle GouraudTriangle::resized(double w, double h, LineWidthFlag lineWidthFlag) const
 {
-  return static_cast<GouraudTriangle &>(GouraudTriangle(*this).resize(w, h, lineWidthFlag));
+  GouraudTriangle result(*this);
+  result.resize(w, h, lineWidthFlag);
+  return result;
 }
 
 GouraudTriangle * GouraudTriangle::clone() const
@@ -563,7 +587,7 @@ void GouraudTriangle::flushSVG(std::ostream & stream, const TransformSVG & trans
 void GouraudTriangle::flushTikZ(std::ostream & stream, const TransformTikZ & /*transform*/) const
 {
   // FIXME: unimplemented
-  stream << "% FIXME: GouraudTriangle::flushTikZ unimplemented" << std::endl;
+  stream << "% FIXME: GouraudTriangle::flushTikZ unimplemented" << '\n';
 }
 
 Polyline rectangle(double left, double top, double width, double height, //
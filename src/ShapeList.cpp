@@ -33,10 +33,6 @@
 #include <typeinfo>
 #include <utility>
 
-#if defined(max)
-#undef max
-#endif
-
 namespace LibBoard
 {
 
@@ -120,17 +116,10 @@ ShapeList::ShapeList(const ShapeList & other) : Shape(other)
 ShapeList & ShapeList::operator=(const ShapeList & other)
 {
   deleteShapes();
-  if (!other._shapes.size()) {
-    return *this;
-  }
-  _shapes.resize(other._shapes.size(), nullptr);
-  std::vector<Shape *>::iterator t = _shapes.begin();
-  std::vector<Shape *>::const_iterator i = other._shapes.begin();
-  std::vector<Shape *>::const_iterator end = other._shapes.end();
-  while (i != end) {
-    *t = (*i)->clone();
-    ++i;
-    ++t;
+  _shapes.clear(); // Also drops the deleted pointers when other is empty.
+  _shapes.reserve(other._shapes.size());
+  for (const Shape * shape : other._shapes) {
+    _shapes.push_back(shape->clone());
   }
   return *this;
 }
@@ -423,6 +423,73 @@ const std::set<Color> & FillColorExtractor::colors() const
   return _colors;
 }
 
+PenAndFillColorExtractor::PenAndFillColorExtractor() {}
+
+void PenAndFillColorExtractor::clear()
+{
+  _penColors.clear();
+  _fillColors.clear();
+}
+
+void PenAndFillColorExtractor::visit(const Shape &) {}
+
+void PenAndFillColorExtractor::visit(const Shape &) const
+{
+  Tools::warning << "PenAndFillColorExtractor(): Visiting using the const method does not make sense.\n";
+}
+
+void PenAndFillColorExtractor::visit(const Dot & dot)
+{
+  _penColors.insert(dot.penColor());
+  _fillColors.insert(dot.fillColor());
+}
+
+void PenAndFillColorExtractor::visit(const Line & line)
+{
+  _penColors.insert(line.penColor());
+  _fillColors.insert(line.fillColor());
+}
+
+void PenAndFillColorExtractor::visit(const Arrow & arrow)
+{
+  _penColors.insert(arrow.penColor());
+  _fillColors.insert(arrow.fillColor());
+}
+
+void PenAndFillColorExtractor::visit(const Polyline & p)
+{
+  _penColors.insert(p.penColor());
+  _fillColors.insert(p.fillColor());
+}
+
+void PenAndFillColorExtractor::visit(const Ellipse & e)
+{
+  _penColors.insert(e.penColor());
+  _fillColors.insert(e.fillColor());
+}
+
+void PenAndFillColorExtractor::visit(const Text & text)
+{
+  _penColors.insert(text.penColor());
+  _fillColors.insert(text.fillColor());
+}
+
+void PenAndFillColorExtractor::visit(const Bezier & bezier)
+{
+  _penColors.insert(bezier.penColor());
+  _fillColors.insert(bezier.fillColor());
+}
+
+const std::set<Color> & PenAndFillColorExtractor::penColors() const
+{
+  return _penColors;
+}
+
+const std::set<Color> & PenAndFillColorExtractor::fillColors() const
+{
+  return _fillColors;
+}
+
 ConstLeafVisitor::ConstLeafVisitor(std::function<void(const Shape &)> f) : _f(f) {}
 
 void ConstLeafVisitor::visit(const Shape &) {}
@@ -59,7 +59,7 @@ const char * xFigDashStylesTikZ[] = {
 
 Style Style::_defaultStyle{Color(0, 0, 0, 255), Color(nullptr), 1.0, SolidStyle, ButtCap, MiterJoin};
 
-std::stack<Style> Style::_styleStack;
+std::stack<Style, std::vector<Style>> Style::_styleStack;
 
 Style::Style()
 {
@@ -75,11 +75,22 @@ std::string Style::svgProperties(const TransformSVG & transform) const
 {
   static const char * capStrings[3] = {"butt", "round", "square"};
   static const char * joinStrings[3] = {"miter", "round", "bevel"};
+  // Successive shapes of a drawing usually share the same style, so remember
+  // the last formatted result. (Like the default style stack, this cache is
+  // not meant to be thread-safe.)
+  static Style cachedStyle;
+  static double cachedWidth = -1.0;
+  static std::string cachedResult;
+  const double mappedWidth = transform.mapWidth(lineWidth);
+  if (mappedWidth == cachedWidth && penColor == cachedStyle.penColor && fillColor == cachedStyle.fillColor //
+      && lineStyle == cachedStyle.lineStyle && lineCap == cachedStyle.lineCap && lineJoin == cachedStyle.lineJoin) {
+    return cachedResult;
+  }
   std::stringstream str;
   if (penColor != Color::Null) {
     str << " fill=\"" << fillColor.svg() << '"'  //
         << " stroke=\"" << penColor.svg() << '"' //
-        << " stroke-width=\"" << transform.mapWidth(lineWidth) << "mm\""
+        << " stroke-width=\"" << mappedWidth << "mm\""
         << " style=\"stroke-linecap:" << capStrings[lineCap] << ";stroke-linejoin:" << joinStrings[lineJoin];
     if (lineStyle != SolidStyle) {
       str << ";" << xFigDashStylesSVG[lineStyle];
@@ -95,31 +106,55 @@ std::string Style::svgProperties(const TransformSVG & transform) const
         << " style=\"stroke-linecap:round;stroke-linejoin:round;\"" //
         << fillColor.svgAlpha(" fill") << fillColor.svgAlpha(" stroke");
   }
-  return str.str();
+  cachedStyle = *this;
+  cachedWidth = mappedWidth;
+  cachedResult = str.str();
+  return cachedResult;
 }
 
 std::string Style::postscriptProperties(const TransformEPS & transform) const
 {
+  static Style cachedStyle;
+  static double cachedWidth = -1.0;
+  static std::string cachedResult;
+  const double mappedWidth = transform.mapWidth(lineWidth);
+  if (mappedWidth == cachedWidth && lineStyle == cachedStyle.lineStyle && lineCap == cachedStyle.lineCap && lineJoin == cachedStyle.lineJoin) {
+    return cachedResult;
+  }
   std::stringstream str;
-  str << transform.mapWidth(lineWidth) << " slw ";
+  str << mappedWidth << " slw ";
   str << lineCap << " slc ";
   str << lineJoin << " slj";
   str << xFigDashStylesPS[lineStyle];
-  return str.str();
+  cachedStyle = *this;
+  cachedWidth = mappedWidth;
+  cachedResult = str.str();
+  return cachedResult;
 }
 
 std::string Style::tikzProperties(const TransformTikZ & transform) const
 {
   static const char * capStrings[3] = {"" /* initial value "butt" */, "line cap=round,", "line cap=rect,"};
   static const char * joinStrings[3] = {"" /* initial value "miter" */, "line join=round", "line join=bevel"};
+  static Style cachedStyle;
+  static double cachedWidth = -1.0;
+  static std::string cachedResult;
+  const double mappedWidth = transform.mapWidth(lineWidth);
+  if (mappedWidth == cachedWidth && penColor == cachedStyle.penColor && fillColor == cachedStyle.fillColor //
+      && lineStyle == cachedStyle.lineStyle && lineCap == cachedStyle.lineCap && lineJoin == cachedStyle.lineJoin) {
+    return cachedResult;
+  }
   std::stringstream str;
   str << "fill=" << fillColor.tikz() << ',';
   str << "draw=" << penColor.tikz() << ',';
-  str << "line width=" << transform.mapWidth(lineWidth) << "mm,";
+  str << "line width=" << mappedWidth << "mm,";
   str << xFigDashStylesTikZ[lineStyle];
   str << capStrings[lineCap];
   str << joinStrings[lineJoin];
-  return str.str();
+  cachedStyle = *this;
+  cachedWidth = mappedWidth;
+  cachedResult = str.str();
+  return cachedResult;
 }
 
 void Style::setDefaultStyle(const Style & style)
@@ -49,11 +49,11 @@ extern const char * XFigPostscriptFontnames[];
 
 const std::string Text::_name("Text");
 
-Text::Text(double x, double y, const std::string & text, const Fonts::Font font, double size, Color color)
+Text::Text(double x, double y, std::string text, const Fonts::Font font, double size, Color color)
     : ShapeWithStyle(color, Color::Null, 1.0, SolidStyle, ButtCap, MiterJoin), //
-      _text(text), _font(font), _size(size), _xScale(1.0), _yScale(1.0)
+      _text(std::move(text)), _font(font), _size(size), _xScale(1.0), _yScale(1.0)
 {
-  const double width = text.length() * size * 0.71; // Why 0.71? Well, give it a try!
+  const double width = _text.length() * size * 0.71; // Why 0.71? Well, give it a try!
   _box << Point(x, y);
   _box << _box[0] + Point(width, 0);
   _box << _box[0] + Point(width, size);
@@ -61,11 +61,11 @@ Text::Text(double x, double y, const std::string & text, const Fonts::Font font,
   _box.close();
 }
 
-Text::Text(Point p, const std::string & text, const Fonts::Font font, double size, Color color)
+Text::Text(Point p, std::string text, const Fonts::Font font, double size, Color color)
     : ShapeWithStyle(color, Color::Null, 1.0, SolidStyle, ButtCap, MiterJoin), //
-      _text(text), _font(font), _size(size), _xScale(1.0), _yScale(1.0)
+      _text(std::move(text)), _font(font), _size(size), _xScale(1.0), _yScale(1.0)
 {
-  const double width = text.length() * size * 0.71; // Why 0.71? Well, give it a try!
+  const double width = _text.length() * size * 0.71; // Why 0.71? Well, give it a try!
   _box << p;
   _box << _box[0] + Point(width, 0);
   _box << _box[0] + Point(width, size);
@@ -73,11 +73,11 @@ Text::Text(Point p, const std::string & text, const Fonts::Font font, double siz
   _box.close();
 }
 
-Text::Text(double x, double y, const std::string & text, const Fonts::Font font, const std::string & svgFont, double size, Color color)
+Text::Text(double x, double y, std::string text, const Fonts::Font font, std::string svgFont, double size, Color color)
     : ShapeWithStyle(color, Color::Null, 1.0, SolidStyle, ButtCap, MiterJoin), //
-      _text(text), _font(font), _svgFont(svgFont), _size(size), _xScale(1.0), _yScale(1.0)
+      _text(std::move(text)), _font(font), _svgFont(std::move(svgFont)), _size(size), _xScale(1.0), _yScale(1.0)
 {
-  const double width = text.length() * size * 0.71; // Why 0.71? Well, give it a try!
+  const double width = _text.length() * size * 0.71; // Why 0.71? Well, give it a try!
   _box << Point(x, y);
   _box << _box[0] + Point(width, 0);
   _box << _box[0] + Point(width, size);
@@ -85,11 +85,11 @@ Text::Text(double x, double y, const std::string & text, const Fonts::Font font,
   _box.close();
 }
 
-Text::Text(Point p, const std::string & text, const Fonts::Font font, const std::string & svgFont, double size, Color color)
+Text::Text(Point p, std::string text, const Fonts::Font font, std::string svgFont, double size, Color color)
     : ShapeWithStyle(color, Color::Null, 1.0, SolidStyle, ButtCap, MiterJoin), //
-      _text(text), _font(font), _svgFont(svgFont), _size(size), _xScale(1.0), _yScale(1.0)
+      _text(std::move(text)), _font(font), _svgFont(std::move(svgFont)), _size(size), _xScale(1.0), _yScale(1.0)
 {
-  const double width = text.length() * size * 0.71; // Why 0.71? Well, give it a try!
+  const double width = _text.length() * size * 0.71; // Why 0.71? Well, give it a try!
   _box << p;
   _box << _box[0] + Point(width, 0);
   _box << _box[0] + Point(width, size);
@@ -123,7 +123,9 @@ Text & Text::rotate(double angle, const Point & center)
 
 Text Text::rotated(double angle, const Point & center) const
 {
-  return Text(*this).rotate(angle, center);
+  Text result(*this);
+  result.rotate(angle, center);
+  return result;
 }
 
 Text & Text::rotate(double angle)
@@ -141,7 +143,9 @@ Text & Text::rotate(double angle)
 
 Text Text::rotated(double angle) const
 {
-  return Text(*this).rotate(angle);
+  Text result(*this);
+  result.rotate(angle);
+  return result;
 }
 
 Text & Text::translate(double dx, double dy)
@@ -152,7 +156,9 @@ Text & Text::translate(double dx, double dy)
 
 Text Text::translated(double dx, double dy) const
 {
-  return static_cast<Text &>(Text(*this).translate(dx, dy));
+  Text result(*this);
+  result.translate(dx, dy);
+  return result;
 }
 
 Text & Text::scale(double sx, double sy)
@@ -174,12 +180,16 @@ Text & Text::scale(double s)
 
 Text Text::scaled(double sx, double sy) const
 {
-  return Text(*this).scale(sx, sy);
+  Text result(*this);
+  result.scale(sx, sy);
+  return result;
 }
 
 Text Text::scaled(double s) const
 {
-  return Text(*this).scale(s, s);
+  Text result(*this);
+  result.scale(s, s);
+  return result;
 }
 
 void Text::scaleAll(double s)
@@ -231,7 +241,7 @@ void Text::flushPostscript(std::ostream & stream, const TransformEPS & transform
   }
   stream << " (" << _text << ")"
          << " " << penColor().postscript() << " srgb"
-         << " sh gr" << std::endl;
+         << " sh gr" << '\n';
 }
 
 void Text::flushFIG(std::ostream & stream, const TransformFIG & transform, std::map<Color, int> & colormap) const
@@ -261,12 +271,12 @@ void Text::flushSVG(std::ostream & stream, const TransformSVG & transform) const
            << "<text x=\"0\" y=\"0\""
            << " font-family=\"" << (_svgFont.length() ? _svgFont : PSFontNames[_font]) << "\""
            << " font-size=\"" << boxHeight(transform) << "\""
-           << " fill=\"" << penColor().svg() << "\"" << fillColor().svgAlpha(" fill") << penColor().svgAlpha(" stroke") << ">" << _text << "</text></g></g>" << std::endl;
+           << " fill=\"" << penColor().svg() << "\"" << fillColor().svgAlpha(" fill") << penColor().svgAlpha(" stroke") << ">" << _text << "</text></g></g>" << '\n';
   } else {
     stream << "<text x=\"" << transform.mapX(position().x) << "\" y=\"" << transform.mapY(position().y) << "\" "
            << " font-family=\"" << (_svgFont.length() ? _svgFont : PSFontNames[_font]) << "\""
            << " font-size=\"" << boxHeight(transform) << "\""
-           << " fill=\"" << penColor().svg() << "\"" << fillColor().svgAlpha(" fill") << penColor().svgAlpha(" stroke") << ">" << _text << "</text>" << std::endl;
+           << " fill=\"" << penColor().svg() << "\"" << fillColor().svgAlpha(" fill") << penColor().svgAlpha(" stroke") << ">" << _text << "</text>" << '\n';
   }
   // DEBUG
   // Polyline(_box,Color::Black,Color::None,0.5).flushSVG(stream,transform);
@@ -319,7 +329,7 @@ void Text::flushTikZ(std::ostream & stream, const TransformTikZ & transform) con
 
   stream << "\\path[" << _style.tikzProperties(transform) << "] (" << transform.mapX(position().x) << ',' << transform.mapY(position().y) << ") node {"
          << (fontTraits[_font] & ITALIC_FONT ? "\\itshape " : "") << (fontTraits[_font] & BOLD_FONT ? "\\bfseries " : "") << (fontTraits[_font] & MONOSPACE_FONT ? "\\ttfamily " : "")
-         << (fontTraits[_font] & SANSSERIF_FONT ? "\\sffamily " : "") << _text << "};" << std::endl;
+         << (fontTraits[_font] & SANSSERIF_FONT ? "\\sffamily " : "") << _text << "};" << '\n';
 }
 
 void Text::accept(ShapeVisitor & visitor)
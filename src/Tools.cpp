@@ -29,6 +29,7 @@
 #include <board/Rect.h>
 #include <board/Tools.h>
 #include <cctype>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -43,9 +44,30 @@ LibBoard::Tools::MessageStream LibBoard::Tools::error(std::cerr, "Error: ");
 
 namespace
 {
-unsigned long boardRandNext = static_cast<unsigned long>(time(nullptr));
+// xoshiro256++ state (Blackman & Vigna), seeded through splitmix64 so that
+// any seed, including small ones, yields a well-mixed initial state.
+std::uint64_t boardRandState[4];
+
+inline std::uint64_t rotl(std::uint64_t x, int k)
+{
+  return (x << k) | (x >> (64 - k));
+}
+
+void seedBoardRand(unsigned long seed)
+{
+  std::uint64_t z = seed;
+  for (std::uint64_t & word : boardRandState) {
+    z += 0x9e3779b97f4a7c15ULL;
+    std::uint64_t t = z;
+    t = (t ^ (t >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    t = (t ^ (t >> 27)) * 0x94d049bb133111ebULL;
+    word = t ^ (t >> 31);
+  }
 }
 
+const bool boardRandSeeded = (seedBoardRand(static_cast<unsigned long>(time(nullptr))), true);
+} // namespace
+
 namespace LibBoard
 {
 
@@ -55,37 +77,72 @@ namespace Tools
 bool base64encode(std::istream & in, std::ostream & out, int linesize)
 {
   static const unsigned char b64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-  unsigned char input[3];
-  unsigned char output[4];
+  // Encode by blocks rather than byte by byte: each get()/write() on a stream
+  // pays for a sentry object and a virtual call, which by far dominates the
+  // cost of the encoding itself. The input buffer size is a multiple of three
+  // so that a 6-bit group never straddles two reads.
+  char input[3 * 1024];
+  char output[8 * 1024];
+  const int blocksPerLine = (linesize >= 4) ? (linesize / 4) : 1;
   int nbBlocks = 0;
-
-  *input = 0;
-  *output = 0;
   while (in) {
-    int len = 0;
-    for (int i = 0; i < 3; i++) {
-      input[i] = static_cast<unsigned char>(in.get());
-      if (in) {
-        len++;
-      } else {
-        input[i] = 0;
+    in.read(input, sizeof(input));
+    std::streamsize remaining = in.gcount();
+    if (remaining <= 0) {
+      break;
+    }
+    const unsigned char * p = reinterpret_cast<const unsigned char *>(input);
+    std::size_t length = 0;
+    while (remaining >= 3) {
+      // Encode up to a full output line at once, so the line-wrap and the
+      // buffer-flush tests run once per line instead of once per triple.
+      std::size_t triples = static_cast<std::size_t>(remaining) / 3;
+      triples = (std::min)(triples, static_cast<std::size_t>(blocksPerLine - nbBlocks));
+      triples = (std::min)(triples, (sizeof(output) - 2 - length) / 4);
+      if (!triples) {
+        if (!out.write(output, static_cast<std::streamsize>(length))) {
+          return false;
+        }
+        length = 0;
+        continue;
+      }
+      for (std::size_t i = 0; i < triples; ++i) {
+        output[length++] = b64[p[0] >> 2];
+        output[length++] = b64[((p[0] & 0x03) << 4) | (p[1] >> 4)];
+        output[length++] = b64[((p[1] & 0x0f) << 2) | (p[2] >> 6)];
+        output[length++] = b64[p[2] & 0x3f];
+        p += 3;
+      }
+      remaining -= static_cast<std::streamsize>(3 * triples);
+      nbBlocks += static_cast<int>(triples);
+      if (nbBlocks >= blocksPerLine) {
+        output[length++] = '\r';
+        output[length++] = '\n';
+        nbBlocks = 0;
       }
     }
-    if (len > 0) {
-      output[0] = b64[(int)(input[0] >> 2)];
-      output[1] = b64[(int)(((input[0] & 0x03) << 4) | ((input[1] & 0xf0) >> 4))];
-      output[2] = (len > 1 ? b64[(int)(((input[1] & 0x0f) << 2) | ((input[2] & 0xc0) >> 6))] : '=');
-      output[3] = (len > 2 ? b64[(int)(input[2] & 0x3f)] : '=');
-      if (!out.write(reinterpret_cast<char *>(output), 4))
-        return false;
+    if (remaining > 0) { // A partial triple can only occur once, at end of stream.
+      if (length + 4 > sizeof(output)) {
+        if (!out.write(output, static_cast<std::streamsize>(length))) {
+          return false;
+        }
+        length = 0;
+      }
+      const unsigned char first = p[0];
+      const unsigned char second = (remaining > 1) ? p[1] : 0;
+      output[length++] = b64[first >> 2];
+      output[length++] = b64[((first & 0x03) << 4) | (second >> 4)];
+      output[length++] = (remaining > 1) ? b64[(second & 0x0f) << 2] : '=';
+      output[length++] = '=';
       ++nbBlocks;
     }
-    if (nbBlocks >= (linesize / 4) || !in) {
-      if (nbBlocks > 0)
-        out << "\r\n";
-      nbBlocks = 0;
+    if (length && !out.write(output, static_cast<std::streamsize>(length))) {
+      return false;
     }
   }
+  if (nbBlocks > 0) {
+    out << "\r\n";
+  }
   return true;
 }
 
@@ -95,16 +152,13 @@ bool stringEndsWith(const char * str, const char * end, CaseSensitivity sensitiv
   size_t nend = strlen(end);
   if (nstr < nend)
     return false;
+  const char * tail = str + (nstr - nend);
   if (sensitivity == CaseSensitive) {
-    for (size_t i = 1; i <= nend; ++i) {
-      if (str[nstr - i] != end[nend - i])
-        return false;
-    }
-  } else {
-    for (size_t i = 1; i <= nend; ++i) {
-      if (toupper(str[nstr - i]) != toupper(end[nend - i]))
-        return false;
-    }
+    return std::memcmp(tail, end, nend) == 0; // Vectorized in the C library.
+  }
+  for (size_t i = 0; i < nend; ++i) {
+    if (toupper(tail[i]) != toupper(end[i]))
+      return false;
   }
   return true;
 }
@@ -126,26 +180,56 @@ void flushFile(const char * filename, std::ostream & out)
 
 void getEPSBoundingBox(const char * filename, Rect & rect)
 {
-  std::ifstream file;
-  char line[4096];
-  file.open(filename);
-  bool done = false;
-  double x1 = 0, y1 = 0, x2 = 0, y2 = 0;
-  while (file && !done) {
-    file.getline(line, 4096);
-    if (std::strstr(line, "%%BoundingBox:") == line) {
-      if (std::sscanf(line, "%%%%BoundingBox: %lf %lf %lf %lf", &x1, &y1, &x2, &y2) != 4) {
-        error << "getEPSBoundingBox(): Cannot read bounding box information.\n";
-        file.close();
-        rect.clear();
+  static const char pattern[] = "%%BoundingBox:";
+  const std::size_t patternLength = sizeof(pattern) - 1;
+  // Read by 64 KiB blocks and let memchr skip to candidate '%' bytes instead
+  // of extracting every line with getline. Enough bytes are carried over
+  // between blocks for the marker and the four numbers that follow it, so a
+  // match never straddles two reads.
+  const std::size_t overlap = patternLength + 128;
+  std::ifstream file(filename, std::ios::binary);
+  char buffer[64 * 1024];
+  std::size_t length = 0;
+  std::size_t start = 0;
+  bool firstBlock = true;
+  while (file) {
+    file.read(buffer + length, static_cast<std::streamsize>(sizeof(buffer) - 1 - length));
+    length += static_cast<std::size_t>(file.gcount());
+    buffer[length] = '\0';
+    const bool lastBlock = !file;
+    if (length < patternLength) {
+      break;
+    }
+    const std::size_t limit = lastBlock ? (length - patternLength + 1) : ((length > overlap) ? (length - overlap) : 0);
+    const char * p = buffer + start;
+    while (p < buffer + limit) {
+      p = static_cast<const char *>(std::memchr(p, '%', (buffer + limit) - p));
+      if (!p) {
+        break;
+      }
+      const bool atLineStart = (p == buffer) ? firstBlock : (p[-1] == '\n' || p[-1] == '\r');
+      if (atLineStart && std::memcmp(p, pattern, patternLength) == 0) {
+        double x1, y1, x2, y2;
+        if (std::sscanf(p + patternLength, " %lf %lf %lf %lf", &x1, &y1, &x2, &y2) != 4) {
+          error << "getEPSBoundingBox(): Cannot read bounding box information.\n";
+          rect.clear();
+          return;
+        }
+        rect = Rect(x1, y2, x2 - x1, y2 - y1);
         return;
       }
-      done = true;
+      ++p;
     }
+    if (lastBlock) {
+      break;
+    }
+    const std::size_t kept = std::min(length, overlap + 1);
+    std::memmove(buffer, buffer + (length - kept), kept);
+    length = kept;
+    start = 1; // Byte 0 only serves as the line-start context of byte 1.
+    firstBlock = false;
   }
-  file.close();
-  rect = Rect(x1, y2, x2 - x1, y2 - y1);
-  return;
+  rect = Rect(0, 0, 0, 0);
 }
 
 bool canCreateFile(const char * filename)
@@ -219,14 +303,23 @@ const char * temporaryFilename(const char * extension)
 
 void initBoardRand(unsigned long seed)
 {
-  boardRandNext = seed;
+  seedBoardRand(seed);
 }
 
 unsigned int boardRand()
 {
-  boardRandNext = boardRandNext * 1103515245 + 12345;
-  const unsigned long modulo = static_cast<unsigned long>(RAND_MAX) + 1;
-  return static_cast<unsigned int>((boardRandNext / 65536) % modulo);
+  // xoshiro256++: a handful of shifts, xors and adds, with no library call
+  // and no lock, unlike rand().
+  const std::uint64_t result = rotl(boardRandState[0] + boardRandState[3], 23) + boardRandState[0];
+  const std::uint64_t t = boardRandState[1] << 17;
+  boardRandState[2] ^= boardRandState[0];
+  boardRandState[3] ^= boardRandState[1];
+  boardRandState[1] ^= boardRandState[2];
+  boardRandState[0] ^= boardRandState[3];
+  boardRandState[2] ^= t;
+  boardRandState[3] = rotl(boardRandState[3], 45);
+  const std::uint64_t modulo = static_cast<std::uint64_t>(RAND_MAX) + 1;
+  return static_cast<unsigned int>((result >> 32) % modulo);
 }
 
 double boardRandDouble()
@@ -249,7 +342,7 @@ bool solveQuadratic(double a, double b, double c, double & x1, double & x2)
     x1 = x2 = -c / b;
     return true;
   }
-  const double delta = b * b - 4 * a * c;
+  const double delta = std::fma(-4 * a, c, b * b); // b*b - 4*a*c without intermediate rounding
   if (delta < 0.0) {
     return false;
   }
@@ -257,9 +350,14 @@ bool solveQuadratic(double a, double b, double c, double & x1, double & x2)
     x1 = x2 = -b / (2 * a);
     return true;
   }
-  const double twiceA = 2 * a;
-  x1 = (-b - std::sqrt(delta)) / twiceA;
-  x2 = (-b + std::sqrt(delta)) / twiceA;
+  // Citardauq form: compute the root whose numerator does not cancel, then
+  // obtain the other one from the product of the roots (c/a = x1*x2).
+  const double q = -0.5 * (b + std::copysign(std::sqrt(delta), b));
+  x1 = q / a;
+  x2 = c / q;
+  if (b < 0.0) {
+    std::swap(x1, x2); // Preserve the historical ordering (-b-sqrt(delta))/2a first.
+  }
   return true;
 }
 
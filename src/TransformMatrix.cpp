@@ -77,11 +77,6 @@ TransformMatrix & TransformMatrix::operator*=(const TransformMatrix & right)
   return *this;
 }
 
-Point TransformMatrix::operator*(const Point & point) const
-{
-  return Point(_m11 * point.x + _m12 * point.y + _m13, _m21 * point.x + _m22 * point.y + _m23);
-}
-
 TransformMatrix TransformMatrix::operator+(const Point & point) const
 {
   TransformMatrix result(*this);
@@ -213,7 +213,7 @@ unsigned int TransformFIG::mapDepth(unsigned int depth) const
   }
 }
 
-void TransformFIG::setDepthMap(const std::map<const Shape *, unsigned int> * depthMap, unsigned int min)
+void TransformFIG::setDepthMap(const std::unordered_map<const Shape *, unsigned int> * depthMap, unsigned int min)
 {
   _depthMap = depthMap;
   _maxDepth = std::numeric_limits<unsigned int>::max();